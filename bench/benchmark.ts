@@ -0,0 +1,111 @@
+import { setFlagsFromString } from 'v8';
+import { runInNewContext } from 'vm';
+
+export interface BenchmarkResult {
+    // Approximate heap bytes allocated by one operation
+    bytesPerOp: number;
+    opsPerSec: number;
+    p99Ms: number;
+}
+
+const NS_IN_MS = 1e6;
+const MS_IN_SEC = 1000;
+const P99 = 0.99;
+const WARMUP_ITERATIONS = 1000;
+const MEASURE_ITERATIONS = 10000;
+// HINT: Small enough to fit into the V8 young generation, so no GC happens between heap snapshots
+const ALLOCATION_ITERATIONS = 100;
+const WARMUP_MS = 200;
+const MEASURE_MS = 1000;
+
+/**
+ * Set REDIS_URL to run benchmarks against real redis-server, otherwise redis client is replaced with in-memory stub
+ * replying with `roundTrip` latency.
+ */
+export const benchRedisUrl = process.env['REDIS_URL'];
+
+/**
+ * Simulate network round trip of the in-memory redis client stub, reply is resolved on the next event loop iteration.
+ */
+export const roundTrip = <T>(reply: T): Promise<T> => new Promise(resolve => void setImmediate(() => void resolve(reply)));
+
+/**
+ * @returns Milliseconds elapsed since `start` taken from `process.hrtime.bigint()`
+ */
+export const elapsedMs = (start: bigint): number => Number(process.hrtime.bigint() - start) / NS_IN_MS;
+
+setFlagsFromString('--expose-gc');
+const gc = runInNewContext('gc') as () => void;
+
+const measureBytesPerOp = (fn: () => unknown): number => {
+    gc();
+    const heapBefore = process.memoryUsage().heapUsed;
+    for (let i = 0; i < ALLOCATION_ITERATIONS; i++) {
+        fn();
+    }
+    const heapAfter = process.memoryUsage().heapUsed;
+
+    return Math.max(0, Math.round((heapAfter - heapBefore) / ALLOCATION_ITERATIONS));
+};
+
+const runFor = (fn: () => unknown, durationMs: number): { iterations: number; totalMs: number } => {
+    const start = process.hrtime.bigint();
+    let iterations = 0;
+    let totalMs = 0;
+
+    while (totalMs < durationMs) {
+        fn();
+        iterations++;
+        totalMs = elapsedMs(start);
+    }
+
+    return { iterations, totalMs };
+};
+
+/**
+ * Run function for a fixed time after warmup.
+ *
+ * @returns Operations per second
+ */
+export const measureOpsPerSec = (fn: () => unknown): number => {
+    runFor(fn, WARMUP_MS);
+    const { iterations, totalMs } = runFor(fn, MEASURE_MS);
+
+    return Math.round((iterations * MS_IN_SEC) / totalMs);
+};
+
+export const runBenchmark = (stage: string, fn: () => unknown): BenchmarkResult => {
+    for (let i = 0; i < WARMUP_ITERATIONS; i++) {
+        fn();
+    }
+
+    const durations = new Float64Array(MEASURE_ITERATIONS);
+    let totalMs = 0;
+    for (let i = 0; i < MEASURE_ITERATIONS; i++) {
+        const start = process.hrtime.bigint();
+        fn();
+        durations[i] = elapsedMs(start);
+        totalMs += durations[i];
+    }
+    durations.sort();
+
+    const result = {
+        bytesPerOp: measureBytesPerOp(fn),
+        opsPerSec: Math.round((MEASURE_ITERATIONS * MS_IN_SEC) / totalMs),
+        p99Ms: durations[Math.floor(MEASURE_ITERATIONS * P99)],
+    };
+
+    // eslint-disable-next-line no-console
+    console.log(`${stage}: ${result.opsPerSec} ops/sec, p99 ${result.p99Ms.toFixed(4)}ms, ~${result.bytesPerOp} bytes/op`);
+
+    return result;
+};
+
+/**
+ * Report-only comparison with a reference measured in the same run, benchmarks are noisy on shared machines, so they
+ * are not used as a pass/fail gate.
+ *
+ * @returns Stage throughput relative to the reference, e.g. `2.50x`
+ */
+export const formatSpeedup = (result: BenchmarkResult, reference: BenchmarkResult): string =>
+    `${(result.opsPerSec / reference.opsPerSec).toFixed(2)}x`;
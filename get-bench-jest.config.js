@@ -0,0 +1,7 @@
+module.exports = packageName => ({
+    displayName: `${packageName}-bench`,
+    rootDir: '..',
+    testRegex: './bench/.*\\.bench\\.ts$',
+    testEnvironment: 'node',
+    reporters: ['default'],
+});
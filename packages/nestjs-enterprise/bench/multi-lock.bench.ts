@@ -0,0 +1,74 @@
+import { describe, expect, it } from '@jest/globals';
+import { Redis } from 'ioredis';
+
+import { benchRedisUrl, elapsedMs, roundTrip } from '../../../bench/benchmark';
+import { MultiLock } from '../src/decorator/lock/multi-lock/multi-lock';
+
+const DURATION = 10000;
+const ITERATIONS = 20;
+
+const keyCounts = [1, 10, 100, 1000];
+
+const createMemoryClient = (): Redis =>
+    ({
+        isCluster: false,
+        set: () => roundTrip('OK'),
+        del: () => roundTrip(1),
+        pipeline: (commands: Array<Array<number | string>>) => ({
+            exec: () =>
+                roundTrip(
+                    commands.map(([, , keysCount]) => [null, Array.from({ length: Number(keysCount) }, (_, idx) => idx + 1)])
+                ),
+        }),
+    }) as unknown as Redis;
+
+// HINT: Baseline - one SET NX round trip per key, the way per-key locks are taken
+const lockPerKey = async (redis: Redis, keys: string[]): Promise<void> => {
+    for (const key of keys) {
+        // eslint-disable-next-line no-await-in-loop
+        await redis.set(key, 'value', 'PX', DURATION, 'NX');
+    }
+    await Promise.all(keys.map(key => redis.del(key)));
+};
+
+const lockMulti = async (multiLock: MultiLock, keys: string[]): Promise<void> => {
+    const { acquired, release } = await multiLock.acquire(keys, DURATION);
+
+    expect(acquired).toHaveLength(keys.length);
+    await release();
+};
+
+const measureLatencyMs = async (fn: () => Promise<void>): Promise<number> => {
+    const start = process.hrtime.bigint();
+    for (let idx = 0; idx < ITERATIONS; idx++) {
+        // eslint-disable-next-line no-await-in-loop
+        await fn();
+    }
+
+    return elapsedMs(start) / ITERATIONS;
+};
+
+describe('MultiLock acquire latency', () => {
+    it('per-key lock vs MultiLock', async () => {
+        const redis = benchRedisUrl === undefined ? createMemoryClient() : new Redis(benchRedisUrl);
+        const multiLock = new MultiLock(redis);
+        const results = [];
+
+        for (const keyCount of keyCounts) {
+            const keys = Array.from({ length: keyCount }, (_, idx) => `bench-multi-lock:${idx}`);
+
+            results.push({
+                keys: keyCount,
+                'per-key ms': await measureLatencyMs(() => lockPerKey(redis, keys)),
+                'MultiLock ms': await measureLatencyMs(() => lockMulti(multiLock, keys)),
+            });
+        }
+
+        if (benchRedisUrl !== undefined) {
+            redis.disconnect();
+        }
+
+        // eslint-disable-next-line no-console
+        console.table(results);
+    });
+});
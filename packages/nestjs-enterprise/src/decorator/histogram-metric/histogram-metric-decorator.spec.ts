@@ -1,5 +1,6 @@
 import { describe, expect, it, jest } from '@jest/globals';
 import { Histogram } from 'prom-client';
+import { type Observable, Subject } from 'rxjs';
 
 import { HistogramMetric } from './histogram-metric.decorator';
 
@@ -21,16 +22,35 @@ class TestClass {
     }
 }
 
-const mockEndTimer = jest.fn();
+const mockObserve = jest.fn();
+const mockGetSingleMetric = jest.fn((_name: string): unknown => undefined);
 jest.mock('prom-client', () => ({
     Histogram: jest.fn().mockImplementation(() => ({
-        startTimer: jest.fn().mockImplementation(() => mockEndTimer),
+        observe: (labels: unknown, value: unknown) => mockObserve(labels, value),
     })),
     register: {
-        getSingleMetric: jest.fn().mockReturnValue(undefined),
+        getSingleMetric: (name: string) => mockGetSingleMetric(name),
     },
 }));
 
+const subject$ = new Subject<number>();
+
+class AsyncTestClass {
+    @HistogramMetric('test-async-metric', { statusLabel: 'status' })
+    testPromise(promise: Promise<number>): Promise<number> {
+        return promise;
+    }
+
+    @HistogramMetric<'id' | 'status', Observable<number>, [string]>('test-observable-metric', {
+        labelNames: ['id'],
+        labels: id => ({ id }),
+        statusLabel: 'status',
+    })
+    testObservable(_id: string): Observable<number> {
+        return subject$;
+    }
+}
+
 describe(`HistogramMetric decorator`, () => {
     it('should create and run histogram metric', () => {
         expect.assertions(2);
@@ -42,7 +62,7 @@ describe(`HistogramMetric decorator`, () => {
             name: 'test-metric',
             help: 'test-metric',
         });
-        expect(mockEndTimer).toHaveBeenCalledWith();
+        expect(mockObserve).toHaveBeenCalledWith({}, expect.any(Number));
     });
 
     it('should create and run histogram metric with configuration', () => {
@@ -56,7 +76,7 @@ describe(`HistogramMetric decorator`, () => {
             help: 'test-help',
             buckets: [1],
         });
-        expect(mockEndTimer).toHaveBeenCalledWith();
+        expect(mockObserve).toHaveBeenCalledWith({}, expect.any(Number));
     });
 
     it('should create and run histogram metric with method error', () => {
@@ -70,6 +90,85 @@ describe(`HistogramMetric decorator`, () => {
             name: 'test-metric',
             help: 'test-metric',
         });
-        expect(mockEndTimer).toHaveBeenCalledWith();
+        expect(mockObserve).toHaveBeenCalledWith({}, expect.any(Number));
+    });
+
+    it('should measure promise method until it settles and set status label', async () => {
+        expect.assertions(3);
+
+        mockObserve.mockClear();
+        const testClass = new AsyncTestClass();
+        let resolvePromise: (value: number) => void = () => void 0;
+        const result = testClass.testPromise(new Promise<number>(resolve => void (resolvePromise = resolve)));
+
+        expect(mockObserve).not.toHaveBeenCalled();
+
+        resolvePromise(1);
+
+        await expect(result).resolves.toBe(1);
+        expect(mockObserve).toHaveBeenCalledWith({ status: 'success' }, expect.any(Number));
+    });
+
+    it('should set error status label if promise rejects', async () => {
+        expect.assertions(2);
+
+        mockObserve.mockClear();
+        const testClass = new AsyncTestClass();
+
+        await expect(testClass.testPromise(Promise.reject(new Error('test-error')))).rejects.toThrow('test-error');
+        expect(mockObserve).toHaveBeenCalledWith({ status: 'error' }, expect.any(Number));
+    });
+
+    it('should measure observable method from subscription till completion with labels from arguments', () => {
+        expect.assertions(4);
+
+        mockObserve.mockClear();
+        const testClass = new AsyncTestClass();
+
+        expect(Histogram).toHaveBeenCalledWith({
+            name: 'test-observable-metric',
+            help: 'test-observable-metric',
+            labelNames: ['id', 'status'],
+        });
+
+        const result$ = testClass.testObservable('1');
+
+        expect(mockObserve).not.toHaveBeenCalled();
+
+        result$.subscribe();
+        subject$.complete();
+
+        expect(mockObserve).toHaveBeenCalledTimes(1);
+        expect(mockObserve).toHaveBeenCalledWith({ id: '1', status: 'success' }, expect.any(Number));
+    });
+
+    it('should use registered histogram with status label', () => {
+        expect.assertions(2);
+
+        const registeredObserve = jest.fn();
+        mockGetSingleMetric.mockReturnValueOnce({ labelNames: ['status'], observe: registeredObserve });
+        (Histogram as unknown as jest.Mock).mockClear();
+
+        class RegisteredTestClass {
+            @HistogramMetric('test-registered-metric', { statusLabel: 'status' })
+            testMethod(): number {
+                return 0;
+            }
+        }
+
+        new RegisteredTestClass().testMethod();
+
+        expect(Histogram).not.toHaveBeenCalled();
+        expect(registeredObserve).toHaveBeenCalledWith({ status: 'success' }, expect.any(Number));
+    });
+
+    it('should throw if registered histogram has no status label', () => {
+        expect.assertions(1);
+
+        mockGetSingleMetric.mockReturnValueOnce({ labelNames: ['id'] });
+
+        expect(() =>
+            HistogramMetric('test-registered-metric', { statusLabel: 'status' })({}, 'testMethod', { value: () => 0 })
+        ).toThrow('Histogram metric "test-registered-metric" is already registered without "status" status label');
     });
 });
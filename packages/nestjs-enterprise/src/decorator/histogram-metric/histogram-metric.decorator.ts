@@ -1,37 +1,103 @@
-import { Histogram, type HistogramConfiguration, register } from 'prom-client';
+import { Histogram, type LabelValues, register } from 'prom-client';
+import { type Observable, defer, isObservable, tap } from 'rxjs';
 
-import { isDefined } from '@rnw-community/shared';
+import { isDefined, isPromise } from '@rnw-community/shared';
 
+import type { HistogramMetricConfigurationType } from './type/histogram-metric-configuration.type';
 import type { MethodDecoratorType } from '../../type/method-decorator.type';
 
+type HistogramMetricStatus = 'error' | 'success';
+
+const NANOSECONDS_IN_SECOND = 1e9;
+
+const getRegisteredHistogram = <M extends string>(metricName: string, statusLabel?: M): Histogram<M> | undefined => {
+    const histogram = register.getSingleMetric(metricName) as Histogram<M> | undefined;
+    const { labelNames = [] } = (histogram ?? {}) as { labelNames?: string[] };
+
+    if (isDefined(histogram) && isDefined(statusLabel) && !labelNames.includes(statusLabel)) {
+        throw new Error(`Histogram metric "${metricName}" is already registered without "${statusLabel}" status label`);
+    }
+
+    return histogram;
+};
+
 export const HistogramMetric =
     <M extends string, TResult, TArgs extends unknown[] = unknown[]>(
         metricName: string,
-        configuration?: Omit<HistogramConfiguration<M>, 'name'>
+        configuration: HistogramMetricConfigurationType<M, TArgs> = {}
     ): MethodDecoratorType<TResult, TArgs> =>
     (_target, _propertyKey, descriptor) => {
-        let histogram = register.getSingleMetric(metricName) as Histogram<M> | undefined;
+        const { labels: getLabels, statusLabel, ...histogramConfiguration } = configuration;
+        const labelNames = [...(histogramConfiguration.labelNames ?? [])];
 
-        if (!isDefined(histogram)) {
-            histogram = new Histogram({
+        if (isDefined(statusLabel) && !labelNames.includes(statusLabel)) {
+            labelNames.push(statusLabel);
+        }
+
+        const histogram =
+            getRegisteredHistogram(metricName, statusLabel) ??
+            new Histogram<M>({
                 help: metricName,
-                ...configuration,
+                ...histogramConfiguration,
+                ...(labelNames.length > 0 && { labelNames }),
                 name: metricName,
             });
-        }
+
+        const observe = (labels: LabelValues<M> | undefined, startedAt: bigint, status: HistogramMetricStatus): void =>
+            void histogram.observe(
+                { ...labels, ...(isDefined(statusLabel) && { [statusLabel]: status }) } as LabelValues<M>,
+                Number(process.hrtime.bigint() - startedAt) / NANOSECONDS_IN_SECOND
+            );
 
         // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
         const originalMethod = descriptor.value!;
 
-        // eslint-disable-next-line max-statements,func-names
+        // eslint-disable-next-line func-names
         descriptor.value = function (...args: TArgs) {
-            const endHistogram = histogram.startTimer();
+            const labels = getLabels?.(args[0], args[1], args[2], args[3], args[4]);
+            const startedAt = process.hrtime.bigint();
+            let result: TResult;
 
             try {
-                return originalMethod.apply(this, args);
-            } finally {
-                endHistogram();
+                result = originalMethod.apply(this, args);
+            } catch (error) {
+                observe(labels, startedAt, 'error');
+
+                throw error;
             }
+
+            // HINT: Observable is timed from subscription till completion or error, every subscription separately
+            if (isObservable(result)) {
+                const result$ = result as Observable<unknown>;
+
+                return defer(() => {
+                    const subscribedAt = process.hrtime.bigint();
+
+                    return result$.pipe(
+                        tap({
+                            complete: () => void observe(labels, subscribedAt, 'success'),
+                            error: () => void observe(labels, subscribedAt, 'error'),
+                        })
+                    );
+                }) as unknown as TResult;
+            } else if (isPromise(result)) {
+                return result.then(
+                    value => {
+                        observe(labels, startedAt, 'success');
+
+                        return value;
+                    },
+                    (error: unknown) => {
+                        observe(labels, startedAt, 'error');
+
+                        throw error;
+                    }
+                ) as unknown as TResult;
+            }
+
+            observe(labels, startedAt, 'success');
+
+            return result;
         };
 
         return descriptor;
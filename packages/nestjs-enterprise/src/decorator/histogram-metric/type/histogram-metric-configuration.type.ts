@@ -0,0 +1,12 @@
+import type { PreDecoratorFunction } from '../../../type/pre-decorator-function.type';
+import type { HistogramConfiguration, LabelValues } from 'prom-client';
+
+export type HistogramMetricConfigurationType<M extends string, TArgs extends unknown[]> = Omit<
+    HistogramConfiguration<M>,
+    'name'
+> & {
+    // Extract label values from the method arguments
+    labels?: PreDecoratorFunction<TArgs, LabelValues<M>>;
+    // Label name for the method result status, `success` or `error`
+    statusLabel?: M;
+};
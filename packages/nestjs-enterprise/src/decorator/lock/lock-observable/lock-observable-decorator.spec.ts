@@ -1,7 +1,7 @@
 /* eslint-disable jest/no-done-callback */
-import { beforeEach, describe, expect, it, jest } from '@jest/globals';
+import { afterEach, beforeEach, describe, expect, it, jest } from '@jest/globals';
 import Redis from 'ioredis';
-import { Observable, of } from 'rxjs';
+import { Observable, Subject, lastValueFrom, of, throwError } from 'rxjs';
 
 import { getErrorMessage } from '@rnw-community/shared';
 
@@ -9,16 +9,25 @@ import { LockableService } from '../service/lockable.service';
 
 import { LockObservable } from './lock-observable.decorator';
 
+const lockDuration = 1000;
+const extensionThreshold = 500;
+
 const getRedisService = (): Redis => jest.fn() as unknown as Redis;
 const mockRelease = jest.fn<() => Promise<boolean>>().mockResolvedValue(true);
-const mockAcquire = jest
-    .fn<() => Promise<{ release: () => Promise<boolean> }>>()
-    .mockResolvedValue({ release: mockRelease });
+const mockExtend = jest.fn<() => Promise<unknown>>();
+const getLock = (): Record<string, unknown> => ({
+    expiration: Date.now() + lockDuration,
+    extend: mockExtend,
+    release: mockRelease,
+    resources: ['test'],
+});
+const mockAcquire = jest.fn<() => Promise<unknown>>().mockImplementation(() => Promise.resolve(getLock()));
 
 jest.mock('redlock', () =>
     jest.fn().mockImplementation(() => ({
         acquire: mockAcquire,
         release: mockRelease,
+        settings: { automaticExtensionThreshold: 500 },
     }))
 );
 
@@ -53,6 +62,16 @@ class TestObservableClass extends LockableService {
     testEmptyResource$(): Observable<number> {
         return of(this.field);
     }
+
+    @LockObservable(['test'], 1000)
+    testSubject$(subject: Subject<number>): Observable<number> {
+        return subject;
+    }
+
+    @LockObservable(['test'], 1000)
+    testError$(): Observable<number> {
+        return throwError(() => new Error('FAIL'));
+    }
 }
 
 // eslint-disable-next-line max-lines-per-function
@@ -62,6 +81,11 @@ describe('LockObservableDecorator', () => {
         jest.clearAllMocks();
     });
 
+    // eslint-disable-next-line jest/no-hooks
+    afterEach(() => {
+        jest.useRealTimers();
+    });
+
     it('should lock resource with key as array and duration', done => {
         expect.assertions(3);
 
@@ -71,6 +95,8 @@ describe('LockObservableDecorator', () => {
             next: value => {
                 expect(mockAcquire).toHaveBeenCalledWith([`test`], 1000);
                 expect(value).toBe(1);
+            },
+            complete: () => {
                 expect(mockRelease).toHaveBeenCalledWith();
 
                 done();
@@ -87,6 +113,8 @@ describe('LockObservableDecorator', () => {
             next: value => {
                 expect(mockAcquire).toHaveBeenCalledWith([`test`, `1`], 1000);
                 expect(value).toStrictEqual({ field: 1, id: 1 });
+            },
+            complete: () => {
                 expect(mockRelease).toHaveBeenCalledWith();
 
                 done();
@@ -94,6 +122,87 @@ describe('LockObservableDecorator', () => {
         });
     });
 
+    it('should hold lock until method observable completes', async () => {
+        expect.assertions(3);
+
+        const instance = new TestObservableClass();
+        const subject = new Subject<number>();
+
+        const result = lastValueFrom(instance.testSubject$(subject));
+        await Promise.resolve();
+        subject.next(1);
+
+        expect(mockRelease).not.toHaveBeenCalled();
+
+        subject.complete();
+
+        await expect(result).resolves.toBe(1);
+        expect(mockRelease).toHaveBeenCalledTimes(1);
+    });
+
+    it('should release lock when method observable is unsubscribed', async () => {
+        expect.assertions(2);
+
+        const instance = new TestObservableClass();
+        const subject = new Subject<number>();
+
+        const subscription = instance.testSubject$(subject).subscribe();
+        await Promise.resolve();
+
+        expect(mockRelease).not.toHaveBeenCalled();
+
+        subscription.unsubscribe();
+
+        expect(mockRelease).toHaveBeenCalledTimes(1);
+    });
+
+    it('should release lock when method observable errors', async () => {
+        expect.assertions(2);
+
+        const instance = new TestObservableClass();
+
+        await expect(lastValueFrom(instance.testError$())).rejects.toThrow('FAIL');
+        expect(mockRelease).toHaveBeenCalledTimes(1);
+    });
+
+    it('should extend lock while method observable is subscribed', async () => {
+        expect.assertions(3);
+
+        jest.useFakeTimers();
+        mockExtend.mockImplementation(() => Promise.resolve(getLock()));
+        const instance = new TestObservableClass();
+        const subject = new Subject<number>();
+
+        const subscription = instance.testSubject$(subject).subscribe();
+        await jest.advanceTimersByTimeAsync(extensionThreshold);
+
+        expect(mockExtend).toHaveBeenCalledWith(lockDuration);
+
+        await jest.advanceTimersByTimeAsync(extensionThreshold);
+
+        expect(mockExtend).toHaveBeenCalledTimes(2);
+
+        subscription.unsubscribe();
+        await jest.advanceTimersByTimeAsync(lockDuration);
+
+        expect(mockExtend).toHaveBeenCalledTimes(2);
+    });
+
+    it('should throw error if lock extension fails', async () => {
+        expect.assertions(2);
+
+        jest.useFakeTimers();
+        mockExtend.mockRejectedValue(new Error('ExecutionError'));
+        const instance = new TestObservableClass();
+
+        const result = lastValueFrom(instance.testSubject$(new Subject<number>()));
+        const expectation = expect(result).rejects.toThrow('Lock for test was lost');
+        await jest.advanceTimersByTimeAsync(extensionThreshold);
+
+        await expectation;
+        expect(mockRelease).toHaveBeenCalledTimes(1);
+    });
+
     it('should throw error if redlock is not available', done => {
         expect.assertions(3);
 
@@ -130,20 +239,16 @@ describe('LockObservableDecorator', () => {
         });
     });
 
-    it('should throw error if decorated method does not return Observable', done => {
+    it('should throw error if decorated method does not return Observable', async () => {
         expect.assertions(3);
 
         const instance = new TestObservableClass();
 
         // HINT: Wrong types test
-        (instance.testSync() as unknown as Observable<number>).subscribe({
-            error: (error: unknown) => {
-                expect(getErrorMessage(error)).toBe(`Method TestObservableClass::testSync does not return an observable`);
-                expect(mockAcquire).toHaveBeenCalledWith([`test`], 1000);
-                expect(mockRelease).toHaveBeenCalledWith();
-
-                done();
-            },
-        });
+        await expect(lastValueFrom(instance.testSync() as unknown as Observable<number>)).rejects.toThrow(
+            `Method TestObservableClass::testSync does not return an observable`
+        );
+        expect(mockAcquire).toHaveBeenCalledWith([`test`], 1000);
+        expect(mockRelease).toHaveBeenCalledWith();
     });
 });
@@ -1,5 +1,6 @@
-import { type Observable, concatMap, from, isObservable, map, of, tap } from 'rxjs';
+import { type Observable, concatMap, defer, from, isObservable, map, of, tap } from 'rxjs';
 
+import { holdLock$ } from '../util/hold-lock.util';
 import { runPreLock } from '../util/run-pre-lock.util';
 import { validateRedlock } from '../util/validate-redlock.util';
 
@@ -16,28 +17,28 @@ export const LockObservable =
         // eslint-disable-next-line @typescript-eslint/no-non-null-assertion
         const originalMethod = descriptor.value!;
 
-        // eslint-disable-next-line max-statements,func-names
+        // eslint-disable-next-line func-names
         descriptor.value = function (this: LockableService, ...args: TArgs) {
+            const method$ = defer(() => {
+                const result = originalMethod.apply(this, args) as Observable<TResult>;
+
+                if (!isObservable(result)) {
+                    throw new Error(
+                        `Method ${target.constructor.name}::${String(propertyKey)} does not return an observable`
+                    );
+                }
+
+                return result;
+            });
+
             return of(true).pipe(
                 tap(() => void validateRedlock(this)),
                 map(() => runPreLock(preLock, ...args)),
                 concatMap(lockKeys => from(this.redlock.acquire(lockKeys, duration))),
-                concatMap(currentLock => {
-                    try {
-                        const result = originalMethod.apply(this, args) as Observable<TResult>;
-
-                        if (!isObservable(result)) {
-                            throw new Error(
-                                `Method ${target.constructor.name}::${String(propertyKey)} does not return an observable`
-                            );
-                        }
-
-                        return result;
-                    } finally {
-                        // HINT: Finalize does not work in this case, rxjs bug?
-                        void currentLock.release();
-                    }
-                })
+                // HINT: Lock is held until method observable completes, errors or is unsubscribed
+                concatMap(currentLock =>
+                    holdLock$(currentLock, duration, this.redlock.settings.automaticExtensionThreshold, method$)
+                )
             ) as TResult;
         };
 
@@ -0,0 +1,6 @@
+export enum MultiLockPolicyEnum {
+    // Acquire all keys or none of them
+    All = 'all',
+    // Acquire all free keys, skipping locked ones
+    Partial = 'partial',
+}
@@ -0,0 +1,133 @@
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { MultiLockPolicyEnum } from './multi-lock-policy.enum';
+import { MultiLock } from './multi-lock';
+
+import type { Cluster, Redis } from 'ioredis';
+
+type PipelineReplies = Array<[Error | null, unknown]> | null;
+type PipelineCommands = Array<Array<number | string>>;
+
+const DURATION = 1000;
+// HINT: `{a}` hash tag maps to slot 15495, `{b}` to slot 3300
+const SLOT_A = 15495;
+const SLOT_B = 3300;
+
+const getRedisClient = (
+    ...replies: PipelineReplies[]
+): { pipeline: jest.Mock<(commands: PipelineCommands) => { exec: () => Promise<PipelineReplies> }>; redis: Redis } => {
+    const exec = jest.fn<() => Promise<PipelineReplies>>();
+    replies.forEach(reply => void exec.mockResolvedValueOnce(reply));
+    const pipeline = jest.fn((_commands: PipelineCommands) => ({ exec }));
+
+    return { pipeline, redis: { isCluster: false, pipeline } as unknown as Redis };
+};
+
+const getKeys = (commands: PipelineCommands): unknown[][] =>
+    commands.map(([, , keysCount, ...args]) => args.slice(0, Number(keysCount)));
+
+const getClusterSlots = (): string[][] => {
+    const slots: string[][] = [];
+    slots[SLOT_A] = ['node-2'];
+    slots[SLOT_B] = ['node-1'];
+
+    return slots;
+};
+
+describe('MultiLock', () => {
+    it('should acquire sorted unique keys in one round trip', async () => {
+        expect.assertions(4);
+
+        const { pipeline, redis } = getRedisClient([[null, [1, 2, 3]]]);
+
+        const { acquired, failed } = await new MultiLock(redis).acquire(['c', 'a', 'b', 'a'], DURATION);
+
+        expect(pipeline).toHaveBeenCalledTimes(1);
+        expect(getKeys(pipeline.mock.calls[0][0])).toStrictEqual([['a', 'b', 'c']]);
+        expect(acquired).toStrictEqual(['a', 'b', 'c']);
+        expect(failed).toStrictEqual([]);
+    });
+
+    it('should not acquire any key if one of them is locked', async () => {
+        expect.assertions(3);
+
+        const { pipeline, redis } = getRedisClient([[null, []]]);
+
+        const { acquired, failed } = await new MultiLock(redis).acquire(['a', 'b'], DURATION);
+
+        expect(acquired).toStrictEqual([]);
+        expect(failed).toStrictEqual(['a', 'b']);
+        expect(pipeline).toHaveBeenCalledTimes(1);
+    });
+
+    it('should acquire free keys and release them with partial policy', async () => {
+        expect.assertions(4);
+
+        const { pipeline, redis } = getRedisClient([[null, [1, 3]]], [[null, 2]]);
+
+        const { acquired, failed, release } = await new MultiLock(redis).acquire(
+            ['a', 'b', 'c'],
+            DURATION,
+            MultiLockPolicyEnum.Partial
+        );
+
+        expect(acquired).toStrictEqual(['a', 'c']);
+        expect(failed).toStrictEqual(['b']);
+        await expect(release()).resolves.toBe(2);
+        expect(getKeys(pipeline.mock.calls[1][0])).toStrictEqual([['a', 'c']]);
+    });
+
+    it('should reject on redis error replies', async () => {
+        expect.assertions(1);
+
+        const { redis } = getRedisClient([[new Error('OOM'), null]]);
+
+        await expect(new MultiLock(redis).acquire(['a'], DURATION, MultiLockPolicyEnum.Partial)).rejects.toThrow('OOM');
+    });
+
+    it('should reject on missing pipeline replies', async () => {
+        expect.assertions(1);
+
+        const { redis } = getRedisClient(null);
+
+        await expect(new MultiLock(redis).acquire(['a'], DURATION)).rejects.toThrow('Missing redis pipeline reply');
+    });
+
+    it('should group keys by cluster node and release acquired nodes if next node fails', async () => {
+        expect.assertions(4);
+
+        const { pipeline } = getRedisClient([[null, [1]]], [[null, []]], [[null, 1]]);
+        const cluster = { isCluster: true, pipeline, slots: getClusterSlots() } as unknown as Cluster;
+
+        const { acquired, failed } = await new MultiLock(cluster).acquire(['{a}1', '{b}1'], DURATION);
+
+        expect(getKeys(pipeline.mock.calls[0][0])).toStrictEqual([['{b}1']]);
+        expect(getKeys(pipeline.mock.calls[1][0])).toStrictEqual([['{a}1']]);
+        expect(getKeys(pipeline.mock.calls[2][0])).toStrictEqual([['{b}1']]);
+        expect({ acquired, failed }).toStrictEqual({ acquired: [], failed: ['{a}1', '{b}1'] });
+    });
+
+    it('should release acquired nodes and reject if next node errors', async () => {
+        expect.assertions(3);
+
+        const { pipeline } = getRedisClient([[null, [1]]], [[new Error('OOM'), null]], [[null, 1]]);
+        const cluster = { isCluster: true, pipeline, slots: getClusterSlots() } as unknown as Cluster;
+
+        await expect(new MultiLock(cluster).acquire(['{a}1', '{b}1'], DURATION)).rejects.toThrow('OOM');
+        expect(pipeline).toHaveBeenCalledTimes(3);
+        expect(getKeys(pipeline.mock.calls[2][0])).toStrictEqual([['{b}1']]);
+    });
+
+    it('should release keys acquired on other nodes and reject if any node errors with partial policy', async () => {
+        expect.assertions(3);
+
+        const { pipeline } = getRedisClient([[null, [1]]], [[new Error('OOM'), null]], [[null, 1]]);
+        const cluster = { isCluster: true, pipeline, slots: getClusterSlots() } as unknown as Cluster;
+
+        await expect(
+            new MultiLock(cluster).acquire(['{a}1', '{b}1'], DURATION, MultiLockPolicyEnum.Partial)
+        ).rejects.toThrow('OOM');
+        expect(pipeline).toHaveBeenCalledTimes(3);
+        expect(getKeys(pipeline.mock.calls[2][0])).toStrictEqual([['{b}1']]);
+    });
+});
@@ -0,0 +1,185 @@
+import { randomBytes } from 'crypto';
+
+import calculateSlot from 'cluster-key-slot';
+
+import { emptyFn, groupBy, isDefined } from '@rnw-community/shared';
+
+import { MultiLockPolicyEnum } from './multi-lock-policy.enum';
+
+import type { MultiLockAcquisitionType } from './type/multi-lock-acquisition.type';
+import type { Cluster, Redis } from 'ioredis';
+
+// HINT: Keys are checked before setting, so either all or none of them are locked
+const ACQUIRE_ALL_SCRIPT = `
+for _, key in ipairs(KEYS) do
+    if redis.call('EXISTS', key) == 1 then
+        return {}
+    end
+end
+local acquired = {}
+for idx, key in ipairs(KEYS) do
+    redis.call('SET', key, ARGV[1], 'PX', ARGV[2])
+    acquired[idx] = idx
+end
+return acquired
+`;
+
+const ACQUIRE_PARTIAL_SCRIPT = `
+local acquired = {}
+for idx, key in ipairs(KEYS) do
+    if redis.call('SET', key, ARGV[1], 'NX', 'PX', ARGV[2]) then
+        acquired[#acquired + 1] = idx
+    end
+end
+return acquired
+`;
+
+const RELEASE_SCRIPT = `
+local released = 0
+for _, key in ipairs(KEYS) do
+    if redis.call('GET', key) == ARGV[1] then
+        released = released + redis.call('DEL', key)
+    end
+end
+return released
+`;
+
+const LOCK_VALUE_BYTES = 16;
+
+// HINT: Keys of one redis node, grouped by hash slot
+type NodeKeys = string[][];
+
+/**
+ * Lock many keys at once with one Lua script call per hash slot, calls for the same redis node are pipelined,
+ * so locking N keys takes one round trip per node instead of N.
+ *
+ * Keys are sorted and nodes are locked in the same order, so overlapping multi-locks do not deadlock each other.
+ * Locks are plain `SET key value PX duration` keys compatible with Redlock locks on the same redis client.
+ * Redis errors reject `acquire`, keys already acquired by the call are released first.
+ */
+export class MultiLock {
+    constructor(private readonly redisClient: Cluster | Redis) {}
+
+    /**
+     * @param keys Lock keys
+     * @param duration Lock duration in milliseconds
+     * @param policy All keys or none, or all free keys
+     */
+    async acquire(
+        keys: string[],
+        duration: number,
+        policy = MultiLockPolicyEnum.All
+    ): Promise<MultiLockAcquisitionType> {
+        const sortedKeys = [...new Set(keys)].sort();
+        const value = randomBytes(LOCK_VALUE_BYTES).toString('hex');
+        const nodes = this.groupByNode(sortedKeys);
+
+        const acquired =
+            policy === MultiLockPolicyEnum.All
+                ? await this.acquireAll(nodes, value, duration)
+                : await this.acquirePartial(nodes, value, duration);
+        const acquiredSet = new Set(acquired);
+
+        return {
+            acquired,
+            failed: sortedKeys.filter(key => !acquiredSet.has(key)),
+            release: () => this.release(acquired, value),
+        };
+    }
+
+    private async acquireAll(nodes: NodeKeys[], value: string, duration: number): Promise<string[]> {
+        const acquired: string[] = [];
+
+        try {
+            for (const node of nodes) {
+                // HINT: Nodes are locked sequentially in canonical order
+                // eslint-disable-next-line no-await-in-loop
+                const nodeAcquired = await this.acquireNode(node, ACQUIRE_ALL_SCRIPT, value, duration);
+                acquired.push(...nodeAcquired);
+
+                if (nodeAcquired.length < node.flat().length) {
+                    // eslint-disable-next-line no-await-in-loop
+                    await this.release(acquired, value);
+
+                    return [];
+                }
+            }
+        } catch (error: unknown) {
+            await this.release(acquired, value).catch(emptyFn);
+
+            throw error;
+        }
+
+        return acquired;
+    }
+
+    private async acquirePartial(nodes: NodeKeys[], value: string, duration: number): Promise<string[]> {
+        const errors: unknown[] = [];
+
+        // HINT: Nodes are locked in parallel, keys acquired on other nodes are released if any node fails
+        const acquired = (
+            await Promise.all(
+                nodes.map(node =>
+                    this.acquireNode(node, ACQUIRE_PARTIAL_SCRIPT, value, duration).catch((error: unknown) => {
+                        errors.push(error);
+
+                        return [];
+                    })
+                )
+            )
+        ).flat();
+
+        if (errors.length > 0) {
+            await this.release(acquired, value).catch(emptyFn);
+
+            throw errors[0];
+        }
+
+        return acquired;
+    }
+
+    private async acquireNode(node: NodeKeys, script: string, value: string, duration: number): Promise<string[]> {
+        const replies = await this.redisClient
+            .pipeline(node.map(slotKeys => ['eval', script, slotKeys.length, ...slotKeys, value, duration]))
+            .exec();
+
+        return node.flatMap((slotKeys, idx) => {
+            const [error, indexes] = replies?.[idx] ?? [new Error('Missing redis pipeline reply'), null];
+
+            if (isDefined(error)) {
+                throw error;
+            }
+
+            return (indexes as number[]).map(keyIdx => slotKeys[keyIdx - 1]);
+        });
+    }
+
+    private async release(keys: string[], value: string): Promise<number> {
+        const replies = await Promise.all(
+            this.groupByNode(keys).map(node =>
+                this.redisClient
+                    .pipeline(node.map(slotKeys => ['eval', RELEASE_SCRIPT, slotKeys.length, ...slotKeys, value]))
+                    .exec()
+            )
+        );
+
+        return replies.flatMap(nodeReplies => nodeReplies ?? []).reduce((sum, [, released]) => sum + Number(released), 0);
+    }
+
+    private groupByNode(keys: string[]): NodeKeys[] {
+        if (keys.length === 0) {
+            return [];
+        }
+
+        if (!this.redisClient.isCluster) {
+            return [[keys]];
+        }
+
+        const { slots } = this.redisClient as Cluster;
+        const slotKeys = groupBy(keys, key => calculateSlot(key));
+        // HINT: Before slots are loaded keys are grouped by slot, cluster redirects them to the right node
+        const nodes = groupBy([...slotKeys.entries()], ([slot]) => slots[slot]?.[0] ?? String(slot));
+
+        return [...nodes.keys()].sort().map(node => (nodes.get(node) ?? []).map(([, keysOfSlot]) => keysOfSlot));
+    }
+}
@@ -0,0 +1,6 @@
+export interface MultiLockAcquisitionType {
+    acquired: string[];
+    failed: string[];
+    // Release acquired keys, resolves with the number of released keys
+    release: () => Promise<number>;
+}
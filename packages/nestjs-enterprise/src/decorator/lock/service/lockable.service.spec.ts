@@ -0,0 +1,31 @@
+import { describe, expect, it, jest } from '@jest/globals';
+import Redlock from 'redlock';
+
+import { LockableService } from './lockable.service';
+
+import type { Cluster, Redis } from 'ioredis';
+
+jest.mock('redlock', () => jest.fn());
+
+const redisClient = {} as Redis;
+const clusterClient = {} as Cluster;
+
+describe('LockableService', () => {
+    it('should create redlock with single redis client', () => {
+        expect.assertions(1);
+
+        // eslint-disable-next-line no-new
+        new LockableService(redisClient, { retryCount: 0 });
+
+        expect(Redlock).toHaveBeenLastCalledWith([redisClient], { retryCount: 0 });
+    });
+
+    it('should create redlock with multiple redis and cluster clients', () => {
+        expect.assertions(1);
+
+        // eslint-disable-next-line no-new
+        new LockableService([redisClient, clusterClient]);
+
+        expect(Redlock).toHaveBeenLastCalledWith([redisClient, clusterClient], undefined);
+    });
+});
@@ -1,16 +1,19 @@
 import Redlock, { type Settings } from 'redlock';
 
-import type Redis from 'ioredis';
+import type { Cluster, Redis } from 'ioredis';
 
 // HINT: We need redlock instance with redis for the decorator
 export class LockableService {
     public readonly redlock: Redlock;
 
     constructor(
-        // TODO: Add support for multiple redis clients/sentinels/clusters?
-        private readonly redisClient: Redis,
+        /*
+         * Single redis/sentinel/cluster client, or independent redis masters for the Redlock quorum.
+         * HINT: Cluster client is one Redlock instance, lock keys are routed to their hash slot master
+         */
+        redisClients: Array<Cluster | Redis> | Cluster | Redis,
         options?: Partial<Settings>
     ) {
-        this.redlock = new Redlock([this.redisClient], options);
+        this.redlock = new Redlock(Array.isArray(redisClients) ? redisClients : [redisClients], options);
     }
 }
@@ -0,0 +1,34 @@
+import { type Observable, defer, finalize } from 'rxjs';
+
+import { extendLockWhile$ } from '@rnw-community/nestjs-rxjs-lock';
+import { emptyFn } from '@rnw-community/shared';
+
+import type { Lock } from 'redlock';
+
+/**
+ * Hold the lock while source observable is subscribed: lock is extended by `duration` when less than
+ * `extensionThreshold` ms are left before its expiration, and released when source completes, errors or is unsubscribed.
+ *
+ * Source is stopped with an error if lock extension fails, as the lock could be already acquired by someone else.
+ */
+export const holdLock$ = <T>(
+    lock: Lock,
+    duration: number,
+    extensionThreshold: number,
+    source$: Observable<T>
+): Observable<T> =>
+    defer(() => {
+        let currentLock = lock;
+
+        return extendLockWhile$(source$, {
+            expiration: () => currentLock.expiration,
+            extend: async () => {
+                currentLock = await currentLock.extend(duration);
+            },
+            extensionThreshold,
+            onLost: () => new Error(`Lock for ${lock.resources.join(', ')} was lost`),
+        }).pipe(
+            // HINT: Expired lock cannot be released, nothing to handle
+            finalize(() => void currentLock.release().catch(emptyFn))
+        );
+    });
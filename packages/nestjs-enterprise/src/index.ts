@@ -3,3 +3,7 @@ export { HistogramMetric } from './decorator/histogram-metric/histogram-metric.d
 export { LockPromise } from './decorator/lock/lock-promise/lock-promise.decorator';
 export { LockObservable } from './decorator/lock/lock-observable/lock-observable.decorator';
 export { LockableService } from './decorator/lock/service/lockable.service';
+export { MultiLock } from './decorator/lock/multi-lock/multi-lock';
+export { MultiLockPolicyEnum } from './decorator/lock/multi-lock/multi-lock-policy.enum';
+
+export type { MultiLockAcquisitionType } from './decorator/lock/multi-lock/type/multi-lock-acquisition.type';
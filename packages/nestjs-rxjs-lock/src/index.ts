@@ -1,4 +1,9 @@
 export * from './nestjs-rxjs-lock-module.options';
+export type { NestJSRxJSHeldLockInterface } from './interface/nestjs-rxjs-held-lock.interface';
+export type { NestJSRxJSLockExtensionInterface } from './interface/nestjs-rxjs-lock-extension.interface';
+export type { NestJSRxJSLockLeaseInterface } from './interface/nestjs-rxjs-lock-lease.interface';
+export type { NestJSRxJSLockStatsInterface } from './interface/nestjs-rxjs-lock-stats.interface';
 
 export * from './nestjs-rxjs-lock-module/nestjs-rxjs-lock.module';
 export * from './nestjs-rxjs-lock-service/nestjs-rxjs-lock.service';
+export { extendLockWhile$ } from './lock-lease/extend-lock-while';
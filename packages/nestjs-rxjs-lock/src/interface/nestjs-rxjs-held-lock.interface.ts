@@ -0,0 +1,9 @@
+export interface NestJSRxJSHeldLockInterface {
+    // Timestamp in milliseconds when the lock was acquired or handed off
+    acquiredAt: number;
+    // Timestamp in milliseconds when the lock expires unless it is extended
+    expiresAt: number;
+    lockName: string;
+    // Lock owner instance, `ownerId` option
+    owner: string;
+}
@@ -0,0 +1,10 @@
+export interface NestJSRxJSLockExtensionInterface {
+    // Current lock expiration timestamp in milliseconds
+    expiration: () => number;
+    // Extend current lock by `duration`, rejects if the lock is lost
+    extend: () => Promise<unknown>;
+    // Time left before lock expiration in milliseconds, when the lock is extended
+    extensionThreshold: number;
+    // Called when extension fails, returns error the source is stopped with
+    onLost: () => Error;
+}
@@ -0,0 +1,5 @@
+export interface NestJSRxJSLockLeaseInterface {
+    // Increased by every lock holder, storage should reject writes with a token lower than already seen
+    fencingToken: number;
+    lockName: string;
+}
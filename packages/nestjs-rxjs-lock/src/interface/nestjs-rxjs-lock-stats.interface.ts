@@ -0,0 +1,12 @@
+export interface NestJSRxJSLockStatsInterface {
+    // Failed lock acquisition attempts and requests queued behind a local lock holder
+    contentions: number;
+    // Locks lost because lock extension failed
+    expirations: number;
+    // Successful lease extensions
+    extensions: number;
+    // Locks handed off by the previous holder in this process
+    localAcquisitions: number;
+    // Locks acquired in redis
+    remoteAcquisitions: number;
+}
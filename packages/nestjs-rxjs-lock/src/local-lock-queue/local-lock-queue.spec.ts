@@ -0,0 +1,82 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { LocalLockQueue } from './local-lock-queue';
+
+import type { Lock } from 'redlock';
+
+const lockName = 'lock:test';
+const lock = { resources: [lockName] } as unknown as Lock;
+
+describe('LocalLockQueue', () => {
+    it('should give turn to the first caller immediately and queue followers', () => {
+        expect.assertions(3);
+
+        const queue = new LocalLockQueue(1);
+        const turns: Array<Lock | null> = [];
+
+        queue.turn$(lockName).subscribe(turn => void turns.push(turn));
+        queue.turn$(lockName).subscribe(turn => void turns.push(turn));
+
+        expect(turns).toStrictEqual([null]);
+        expect(queue.canHandOff(lockName)).toBe(true);
+
+        queue.next(lockName, lock);
+
+        expect(turns).toStrictEqual([null, lock]);
+    });
+
+    it('should limit number of hand-offs in a row', () => {
+        expect.assertions(3);
+
+        const queue = new LocalLockQueue(1);
+
+        queue.turn$(lockName).subscribe();
+        queue.turn$(lockName).subscribe();
+        queue.turn$(lockName).subscribe();
+        queue.next(lockName, lock);
+
+        expect(queue.canHandOff(lockName)).toBe(false);
+
+        queue.next(lockName, null);
+
+        expect(queue.canHandOff(lockName)).toBe(false);
+
+        queue.turn$(lockName).subscribe();
+
+        expect(queue.canHandOff(lockName)).toBe(true);
+    });
+
+    it('should remove unsubscribed waiter and free the lock without waiters', () => {
+        expect.assertions(2);
+
+        const queue = new LocalLockQueue(1);
+        const turns: Array<Lock | null> = [];
+
+        queue.turn$(lockName).subscribe();
+        queue
+            .turn$(lockName)
+            .subscribe(turn => void turns.push(turn))
+            .unsubscribe();
+        queue.next(lockName, lock);
+        queue.turn$(lockName).subscribe(turn => void turns.push(turn));
+
+        expect(turns).toStrictEqual([null]);
+        expect(queue.canHandOff(lockName)).toBe(false);
+    });
+
+    it('should report busy lock until the last holder leaves', () => {
+        expect.assertions(3);
+
+        const queue = new LocalLockQueue(1);
+
+        expect(queue.isBusy(lockName)).toBe(false);
+
+        queue.turn$(lockName).subscribe();
+
+        expect(queue.isBusy(lockName)).toBe(true);
+
+        queue.next(lockName, null);
+
+        expect(queue.isBusy(lockName)).toBe(false);
+    });
+});
@@ -0,0 +1,85 @@
+import { Observable } from 'rxjs';
+
+import { isDefined } from '@rnw-community/shared';
+
+import type { Lock } from 'redlock';
+
+type LocalLockWaiter = (lock: Lock | null) => void;
+
+interface LocalLockQueueEntry {
+    handoffs: number;
+    waiters: LocalLockWaiter[];
+}
+
+/**
+ * In-process mutex per lock key, so only the queue head talks to redis. Followers wait for their turn
+ * and receive the distributed lock from the previous holder, or null if they have to acquire it themselves.
+ *
+ * Lock is handed off at most `maxHandoffs` times in a row, then it is released so other processes can get it.
+ */
+export class LocalLockQueue {
+    private readonly entries = new Map<string, LocalLockQueueEntry>();
+
+    constructor(private readonly maxHandoffs: number) {}
+
+    /**
+     * Wait for the local turn.
+     *
+     * @returns Observable<Lock | null> Handed off lock, or null if lock should be acquired in redis
+     */
+    turn$(lockName: string): Observable<Lock | null> {
+        return new Observable<Lock | null>(subscriber => {
+            const entry = this.entries.get(lockName);
+            const waiter: LocalLockWaiter = lock => {
+                subscriber.next(lock);
+                subscriber.complete();
+            };
+
+            if (!isDefined(entry)) {
+                this.entries.set(lockName, { handoffs: 0, waiters: [] });
+                waiter(null);
+
+                return undefined;
+            }
+            entry.waiters.push(waiter);
+
+            return () => {
+                const idx = entry.waiters.indexOf(waiter);
+
+                if (idx >= 0) {
+                    entry.waiters.splice(idx, 1);
+                }
+            };
+        });
+    }
+
+    isBusy(lockName: string): boolean {
+        return this.entries.has(lockName);
+    }
+
+    canHandOff(lockName: string): boolean {
+        const entry = this.entries.get(lockName);
+
+        return isDefined(entry) && entry.waiters.length > 0 && entry.handoffs < this.maxHandoffs;
+    }
+
+    /**
+     * Pass the turn to the next local waiter.
+     *
+     * @param lockName Lock key
+     * @param lock Lock handed off to the next waiter, or null if it was released
+     */
+    next(lockName: string, lock: Lock | null): void {
+        const entry = this.entries.get(lockName);
+        const waiter = entry?.waiters.shift();
+
+        if (!isDefined(entry) || !isDefined(waiter)) {
+            this.entries.delete(lockName);
+
+            return;
+        }
+
+        entry.handoffs = isDefined(lock) ? entry.handoffs + 1 : 0;
+        waiter(lock);
+    }
+}
@@ -0,0 +1,36 @@
+import { Observable, concatMap, defer, from, repeat, timer } from 'rxjs';
+
+import type { NestJSRxJSLockExtensionInterface } from '../interface/nestjs-rxjs-lock-extension.interface';
+
+const HALF = 2;
+
+/**
+ * Mirror source$ and extend the lock by `duration` when less than `extensionThreshold` ms are left before its
+ * expiration, lock release is left to the caller.
+ *
+ * Lock not longer than the threshold is extended when half of its time is left, otherwise every extension would
+ * immediately trigger the next one. Source is stopped with `onLost()` error if lock extension fails, as the lock
+ * could be already acquired by someone else.
+ */
+export const extendLockWhile$ = <T>(source$: Observable<T>, extension: NestJSRxJSLockExtensionInterface): Observable<T> =>
+    new Observable<T>(subscriber => {
+        const { expiration, extend, extensionThreshold, onLost } = extension;
+        const extensionDelay = (): number => {
+            const timeLeft = expiration() - Date.now();
+
+            return Math.max(0, timeLeft - extensionThreshold, timeLeft / HALF);
+        };
+
+        const extensionSubscription = defer(() => timer(extensionDelay()))
+            .pipe(
+                concatMap(() => from(extend())),
+                repeat()
+            )
+            .subscribe({ error: () => void subscriber.error(onLost()) });
+        const subscription = source$.subscribe(subscriber);
+
+        return () => {
+            extensionSubscription.unsubscribe();
+            subscription.unsubscribe();
+        };
+    });
@@ -0,0 +1,38 @@
+import type { Redis } from 'ioredis';
+import type { Lock } from 'redlock';
+
+const FENCE_KEY_SUFFIX = ':fence';
+// HINT: Fence key is only a counter cache, it is restored from redis time after expiration
+const FENCE_TTL_MS = 86400000;
+
+/*
+ * Token is issued only if the lock is still held with this lock value. Missing fence key is initialized with redis
+ * time in microseconds, so tokens keep increasing after the fence key expiration.
+ */
+const ISSUE_FENCING_TOKEN_SCRIPT = `
+if redis.call('GET', KEYS[1]) ~= ARGV[1] then
+    return false
+end
+if redis.call('EXISTS', KEYS[2]) == 0 then
+    local time = redis.call('TIME')
+    redis.call('SET', KEYS[2], time[1] .. string.format('%06d', tonumber(time[2])))
+end
+local token = redis.call('INCR', KEYS[2])
+redis.call('PEXPIRE', KEYS[2], ARGV[2])
+return token
+`;
+
+/**
+ * Issue fencing token for the held lock atomically with the lock ownership check.
+ *
+ * @returns Fencing token, or null if the lock is not held anymore
+ */
+export const issueFencingToken = async (redis: Redis, lockName: string, lock: Lock): Promise<number | null> =>
+    (await redis.eval(
+        ISSUE_FENCING_TOKEN_SCRIPT,
+        2,
+        lockName,
+        `${lockName}${FENCE_KEY_SUFFIX}`,
+        lock.value,
+        FENCE_TTL_MS
+    )) as number | null;
@@ -0,0 +1,52 @@
+import { Counter, Gauge, Histogram, register } from 'prom-client';
+
+export interface LockMetrics {
+    acquireDuration: Histogram<'prefix' | 'result'>;
+    contentions: Counter<'prefix'>;
+    extensions: Counter<'prefix'>;
+    held: Gauge<'prefix'>;
+    holdDuration: Histogram<'prefix'>;
+    lost: Counter<'prefix'>;
+    waitDuration: Histogram<'prefix'>;
+}
+
+// HINT: Metrics are registered once per process, and shared by all lock services
+const getOrCreate = <T>(name: string, create: (config: { help: string; name: string }) => T, help: string): T =>
+    (register.getSingleMetric(name) as T | undefined) ?? create({ help, name });
+
+/**
+ * Prometheus lock metrics in the default registry, labeled by lock prefix.
+ */
+export const createLockMetrics = (): LockMetrics => ({
+    acquireDuration: getOrCreate(
+        'lock_acquire_duration_seconds',
+        config => new Histogram({ ...config, labelNames: ['prefix', 'result'] }),
+        'Duration of lock acquisition attempt in redis'
+    ),
+    contentions: getOrCreate(
+        'lock_contentions_total',
+        config => new Counter({ ...config, labelNames: ['prefix'] }),
+        'Lock requests that failed an acquisition attempt or were queued behind a local lock holder'
+    ),
+    extensions: getOrCreate(
+        'lock_extensions_total',
+        config => new Counter({ ...config, labelNames: ['prefix'] }),
+        'Successful lock lease extensions'
+    ),
+    held: getOrCreate('lock_held', config => new Gauge({ ...config, labelNames: ['prefix'] }), 'Currently held locks'),
+    holdDuration: getOrCreate(
+        'lock_hold_duration_seconds',
+        config => new Histogram({ ...config, labelNames: ['prefix'] }),
+        'Time from lock acquisition to its release or hand-off'
+    ),
+    lost: getOrCreate(
+        'lock_lost_total',
+        config => new Counter({ ...config, labelNames: ['prefix'] }),
+        'Locks lost because lock extension failed'
+    ),
+    waitDuration: getOrCreate(
+        'lock_wait_duration_seconds',
+        config => new Histogram({ ...config, labelNames: ['prefix'] }),
+        'Time from lock request to lock acquisition, including local queue and release waiting'
+    ),
+});
@@ -0,0 +1,95 @@
+import { describe, expect, it, jest } from '@jest/globals';
+import { lastValueFrom } from 'rxjs';
+
+import { createLockMetrics } from './lock-metrics';
+import { LockMonitor } from './lock-monitor';
+
+import type { Lock } from 'redlock';
+
+const owner = 'host:1';
+const lockName = 'lock:prefix:test';
+const expiration = 1000;
+
+const getLock = (value: string): Lock =>
+    ({
+        expiration,
+        value,
+        extend: jest.fn<() => Promise<Lock>>().mockResolvedValue({ expiration, value } as Lock),
+    }) as unknown as Lock;
+
+const getMetricValue = async (metric: { get: () => Promise<{ values: Array<{ value: number }> }> }): Promise<number> =>
+    (await metric.get()).values[0]?.value ?? 0;
+
+describe('LockMonitor', () => {
+    it('should register metrics once per process', () => {
+        expect.assertions(1);
+
+        expect(createLockMetrics().held).toBe(createLockMetrics().held);
+    });
+
+    it('should list held locks until they are released', () => {
+        expect.assertions(2);
+
+        const monitor = new LockMonitor(owner);
+        const tracker = monitor.track(lockName, 'prefix');
+
+        tracker.acquired(getLock('token'), false);
+
+        expect(monitor.getHeldLocks()).toStrictEqual([
+            { acquiredAt: expect.any(Number), expiresAt: expiration, lockName, owner },
+        ]);
+
+        tracker.released();
+
+        expect(monitor.getHeldLocks()).toStrictEqual([]);
+    });
+
+    it('should count acquisition attempts, contentions, extensions and lost locks', async () => {
+        expect.assertions(5);
+
+        const metrics = createLockMetrics();
+        const monitor = new LockMonitor(owner, metrics);
+        const tracker = monitor.track(lockName, 'prefix');
+        const lock = getLock('token');
+
+        await expect(lastValueFrom(tracker.attempt$(() => Promise.reject(new Error('Lock is busy'))))).rejects.toThrow(
+            'Lock is busy'
+        );
+        tracker.acquired(await lastValueFrom(tracker.attempt$(() => Promise.resolve(lock))), false);
+        await tracker.extend(expiration);
+        tracker.lost();
+        tracker.released();
+
+        expect(monitor.getStats()).toStrictEqual({
+            contentions: 1,
+            expirations: 1,
+            extensions: 1,
+            localAcquisitions: 0,
+            remoteAcquisitions: 1,
+        });
+        await expect(getMetricValue(metrics.contentions)).resolves.toBe(1);
+        await expect(getMetricValue(metrics.held)).resolves.toBe(0);
+    });
+
+    it('should count contention once per lock request', async () => {
+        expect.assertions(3);
+
+        const monitor = new LockMonitor(owner);
+        const tracker = monitor.track(lockName, 'prefix');
+        const busy$ = tracker.attempt$(() => Promise.reject(new Error('Lock is busy')));
+
+        tracker.contended();
+        await expect(lastValueFrom(busy$)).rejects.toThrow('Lock is busy');
+        await expect(lastValueFrom(busy$)).rejects.toThrow('Lock is busy');
+
+        expect(monitor.getStats()).toMatchObject({ contentions: 1 });
+    });
+
+    it('should fail extension of not acquired lock', async () => {
+        expect.assertions(1);
+
+        await expect(new LockMonitor(owner).track(lockName, 'prefix').extend(expiration)).rejects.toThrow(
+            `Lock ${lockName} is not acquired`
+        );
+    });
+});
@@ -0,0 +1,39 @@
+import { LockTracker } from './lock-tracker';
+
+import type { NestJSRxJSHeldLockInterface } from '../interface/nestjs-rxjs-held-lock.interface';
+import type { NestJSRxJSLockStatsInterface } from '../interface/nestjs-rxjs-lock-stats.interface';
+import type { LockMetrics } from './lock-metrics';
+
+/**
+ * Lock statistics, prometheus metrics and locks currently held by this process.
+ */
+export class LockMonitor {
+    readonly heldLocks = new Set<LockTracker>();
+    readonly stats: NestJSRxJSLockStatsInterface = {
+        contentions: 0,
+        expirations: 0,
+        extensions: 0,
+        localAcquisitions: 0,
+        remoteAcquisitions: 0,
+    };
+
+    constructor(
+        readonly owner: string,
+        readonly metrics?: LockMetrics
+    ) {}
+
+    /**
+     * Start tracking the lock request.
+     */
+    track(lockName: string, prefix: string): LockTracker {
+        return new LockTracker(lockName, prefix, this);
+    }
+
+    getStats(): NestJSRxJSLockStatsInterface {
+        return { ...this.stats };
+    }
+
+    getHeldLocks(): NestJSRxJSHeldLockInterface[] {
+        return [...this.heldLocks].map(tracker => tracker.toHeldLock());
+    }
+}
@@ -0,0 +1,108 @@
+import { type Observable, defer, from, tap } from 'rxjs';
+
+import { isDefined } from '@rnw-community/shared';
+
+import type { NestJSRxJSHeldLockInterface } from '../interface/nestjs-rxjs-held-lock.interface';
+import type { LockMonitor } from './lock-monitor';
+import type { Lock } from 'redlock';
+
+const MS_IN_SECOND = 1000;
+
+const secondsSince = (startedAt: number): number => (Date.now() - startedAt) / MS_IN_SECOND;
+
+/**
+ * Single lock request from the request to the release, holds the latest lock as extended lock replaces the previous one.
+ */
+export class LockTracker {
+    lock: Lock | null = null;
+
+    private readonly requestedAt = Date.now();
+    private acquiredAt = 0;
+    private isContended = false;
+
+    constructor(
+        readonly lockName: string,
+        private readonly prefix: string,
+        private readonly monitor: LockMonitor
+    ) {}
+
+    /**
+     * Lock acquisition attempt in redis, failed attempt marks the request as contended.
+     */
+    attempt$(acquire: () => Promise<Lock>): Observable<Lock> {
+        return defer(() => {
+            const startedAt = Date.now();
+
+            return from(acquire()).pipe(
+                tap({
+                    next: () => void this.attempted(startedAt, true),
+                    error: () => void this.attempted(startedAt, false),
+                })
+            );
+        });
+    }
+
+    /**
+     * Lock request waited for another lock holder, counted once per request however many attempts have failed.
+     */
+    contended(): void {
+        if (this.isContended) {
+            return;
+        }
+
+        this.isContended = true;
+        this.monitor.stats.contentions++;
+        this.monitor.metrics?.contentions.inc({ prefix: this.prefix });
+    }
+
+    acquired(lock: Lock, isHandedOff: boolean): void {
+        this.lock = lock;
+        this.acquiredAt = Date.now();
+        this.monitor.heldLocks.add(this);
+        this.monitor.stats[isHandedOff ? 'localAcquisitions' : 'remoteAcquisitions']++;
+        this.monitor.metrics?.waitDuration.observe({ prefix: this.prefix }, secondsSince(this.requestedAt));
+        this.monitor.metrics?.held.inc({ prefix: this.prefix });
+    }
+
+    async extend(durationMs: number): Promise<void> {
+        if (!isDefined(this.lock)) {
+            throw new Error(`Lock ${this.lockName} is not acquired`);
+        }
+
+        this.lock = await this.lock.extend(durationMs);
+        this.monitor.stats.extensions++;
+        this.monitor.metrics?.extensions.inc({ prefix: this.prefix });
+    }
+
+    lost(): void {
+        this.monitor.stats.expirations++;
+        this.monitor.metrics?.lost.inc({ prefix: this.prefix });
+    }
+
+    released(): void {
+        if (this.monitor.heldLocks.delete(this)) {
+            this.monitor.metrics?.holdDuration.observe({ prefix: this.prefix }, secondsSince(this.acquiredAt));
+            this.monitor.metrics?.held.dec({ prefix: this.prefix });
+        }
+    }
+
+    toHeldLock(): NestJSRxJSHeldLockInterface {
+        return {
+            acquiredAt: this.acquiredAt,
+            expiresAt: this.lock?.expiration ?? this.acquiredAt,
+            lockName: this.lockName,
+            owner: this.monitor.owner,
+        };
+    }
+
+    private attempted(startedAt: number, isAcquired: boolean): void {
+        this.monitor.metrics?.acquireDuration.observe(
+            { prefix: this.prefix, result: isAcquired ? 'acquired' : 'failed' },
+            secondsSince(startedAt)
+        );
+
+        if (!isAcquired) {
+            this.contended();
+        }
+    }
+}
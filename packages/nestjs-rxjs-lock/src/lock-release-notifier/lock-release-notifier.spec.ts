@@ -0,0 +1,111 @@
+import { EventEmitter } from 'events';
+
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { LockReleaseNotifier } from './lock-release-notifier';
+
+import type { Redis } from 'ioredis';
+
+const lockName = 'lock:test';
+const channel = `${lockName}:released`;
+
+const getRedis = (): { publish: jest.Mock; redis: Redis; subscriber: EventEmitter & Record<string, jest.Mock> } => {
+    const subscriber = Object.assign(new EventEmitter(), {
+        disconnect: jest.fn(),
+        subscribe: jest.fn<() => Promise<number>>().mockResolvedValue(1),
+        unsubscribe: jest.fn<() => Promise<number>>().mockResolvedValue(0),
+    });
+    const publish = jest.fn<() => Promise<number>>().mockResolvedValue(1);
+
+    return { publish, redis: { duplicate: () => subscriber, publish } as unknown as Redis, subscriber };
+};
+
+describe('LockReleaseNotifier', () => {
+    it('should subscribe lock channel while lock has waiters', () => {
+        expect.assertions(4);
+
+        const { redis, subscriber } = getRedis();
+        const notifier = new LockReleaseNotifier(redis);
+
+        const first = notifier.join(lockName);
+        const second = notifier.join(lockName);
+
+        expect(subscriber.subscribe).toHaveBeenCalledTimes(1);
+        expect(subscriber.subscribe).toHaveBeenCalledWith(channel);
+
+        notifier.leave(lockName, first, true);
+        notifier.leave(lockName, second, true);
+        notifier.leave(lockName, second, true);
+
+        expect(subscriber.unsubscribe).toHaveBeenCalledTimes(1);
+        expect(subscriber.unsubscribe).toHaveBeenCalledWith(channel);
+    });
+
+    it('should resolve subscription when channel is subscribed or subscription fails', async () => {
+        expect.assertions(2);
+
+        const { redis, subscriber } = getRedis();
+        subscriber.subscribe.mockRejectedValueOnce(new Error('FAIL'));
+        const notifier = new LockReleaseNotifier(redis);
+
+        notifier.join(lockName);
+
+        await expect(notifier.subscribed(lockName)).resolves.toBeUndefined();
+        await expect(notifier.subscribed('lock:other')).resolves.toBeUndefined();
+    });
+
+    it('should wake up only queue head on release notification', () => {
+        expect.assertions(4);
+
+        const { redis, subscriber } = getRedis();
+        const notifier = new LockReleaseNotifier(redis);
+
+        const first = notifier.join(lockName);
+        const second = notifier.join(lockName);
+        const firstWake = jest.spyOn(first, 'wake');
+        const secondWake = jest.spyOn(second, 'wake');
+
+        subscriber.emit('message', channel, '');
+
+        expect(notifier.isHead(lockName, first)).toBe(true);
+        expect(notifier.isHead(lockName, second)).toBe(false);
+        expect(firstWake).toHaveBeenCalledTimes(1);
+        expect(secondWake).not.toHaveBeenCalled();
+    });
+
+    it('should wake up next waiter only if queue head leaves without the lock', () => {
+        expect.assertions(3);
+
+        const { redis } = getRedis();
+        const notifier = new LockReleaseNotifier(redis);
+
+        const first = notifier.join(lockName);
+        const second = notifier.join(lockName);
+        const third = notifier.join(lockName);
+        const secondWake = jest.spyOn(second, 'wake');
+        const thirdWake = jest.spyOn(third, 'wake');
+
+        notifier.leave(lockName, first, false);
+
+        expect(secondWake).toHaveBeenCalledTimes(1);
+
+        notifier.leave(lockName, second, true);
+
+        expect(thirdWake).not.toHaveBeenCalled();
+        expect(notifier.isHead(lockName, third)).toBe(true);
+    });
+
+    it('should publish lock release and close subscriber', async () => {
+        expect.assertions(2);
+
+        const { publish, redis, subscriber } = getRedis();
+        const notifier = new LockReleaseNotifier(redis);
+
+        notifier.join(lockName);
+        await notifier.notify(lockName);
+        notifier.close();
+
+        expect(publish).toHaveBeenCalledWith(channel, '');
+        expect(subscriber.disconnect).toHaveBeenCalledTimes(1);
+    });
+});
@@ -0,0 +1,87 @@
+import { emptyFn, isDefined } from '@rnw-community/shared';
+
+import { LockWaiter } from './lock-waiter';
+
+import type { Redis } from 'ioredis';
+
+const RELEASE_CHANNEL_SUFFIX = ':released';
+
+/**
+ * Wakes lock waiters up on the lock release using redis pub/sub channel per lock key, instead of polling redis.
+ *
+ * Waiters of the same lock in this process form a FIFO queue and release wakes up only the queue head,
+ * channel is subscribed only while the lock has waiters.
+ */
+export class LockReleaseNotifier {
+    private readonly queues = new Map<string, LockWaiter[]>();
+    private readonly subscriptions = new Map<string, Promise<void>>();
+    private subscriber?: Redis;
+
+    constructor(private readonly redis: Redis) {}
+
+    join(lockName: string): LockWaiter {
+        const queue = this.queues.get(lockName) ?? [];
+        const waiter = new LockWaiter();
+
+        if (queue.length === 0) {
+            this.queues.set(lockName, queue);
+            const channel = `${lockName}${RELEASE_CHANNEL_SUFFIX}`;
+            // HINT: Failed SUBSCRIBE is not an error, waiters fall back to the lock expiration
+            this.subscriptions.set(lockName, this.getSubscriber().subscribe(channel).then(emptyFn, emptyFn));
+        }
+        queue.push(waiter);
+
+        return waiter;
+    }
+
+    /**
+     * Resolves when lock channel is subscribed, so release published after it is not missed.
+     */
+    async subscribed(lockName: string): Promise<void> {
+        await this.subscriptions.get(lockName);
+    }
+
+    isHead(lockName: string, waiter: LockWaiter): boolean {
+        return this.queues.get(lockName)?.[0] === waiter;
+    }
+
+    /**
+     * Remove waiter from the queue, next waiter is woken up if queue head leaves without acquiring the lock.
+     */
+    leave(lockName: string, waiter: LockWaiter, isAcquired: boolean): void {
+        const queue = this.queues.get(lockName) ?? [];
+        const idx = queue.indexOf(waiter);
+
+        if (idx < 0) {
+            return;
+        }
+        queue.splice(idx, 1);
+
+        if (queue.length === 0) {
+            this.queues.delete(lockName);
+            this.subscriptions.delete(lockName);
+            void this.getSubscriber().unsubscribe(`${lockName}${RELEASE_CHANNEL_SUFFIX}`).catch(emptyFn);
+        } else if (idx === 0 && !isAcquired) {
+            queue[0].wake();
+        }
+    }
+
+    async notify(lockName: string): Promise<void> {
+        await this.redis.publish(`${lockName}${RELEASE_CHANNEL_SUFFIX}`, '');
+    }
+
+    close(): void {
+        this.subscriber?.disconnect();
+    }
+
+    private getSubscriber(): Redis {
+        if (!isDefined(this.subscriber)) {
+            this.subscriber = this.redis.duplicate();
+            this.subscriber.on('message', (channel: string) => {
+                this.queues.get(channel.slice(0, -RELEASE_CHANNEL_SUFFIX.length))?.[0]?.wake();
+            });
+        }
+
+        return this.subscriber;
+    }
+}
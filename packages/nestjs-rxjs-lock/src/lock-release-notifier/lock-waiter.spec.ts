@@ -0,0 +1,45 @@
+import { afterEach, describe, expect, it, jest } from '@jest/globals';
+import { lastValueFrom } from 'rxjs';
+
+import { LockWaiter } from './lock-waiter';
+
+const fallbackMs = 1000;
+
+describe('LockWaiter', () => {
+    // eslint-disable-next-line jest/no-hooks
+    afterEach(() => {
+        jest.useRealTimers();
+    });
+
+    it('should wait until woken up', async () => {
+        expect.assertions(1);
+
+        const waiter = new LockWaiter();
+        const wait = lastValueFrom(waiter.wait$(fallbackMs));
+
+        waiter.wake();
+
+        await expect(wait).resolves.toBeUndefined();
+    });
+
+    it('should not lose wake up received before waiting', async () => {
+        expect.assertions(1);
+
+        const waiter = new LockWaiter();
+        waiter.wake();
+
+        await expect(lastValueFrom(waiter.wait$(fallbackMs))).resolves.toBe(true);
+    });
+
+    it('should stop waiting after fallback time', async () => {
+        expect.assertions(1);
+
+        jest.useFakeTimers();
+        const waiter = new LockWaiter();
+        const wait = lastValueFrom(waiter.wait$(fallbackMs));
+
+        await jest.advanceTimersByTimeAsync(fallbackMs);
+
+        await expect(wait).resolves.toBe(0);
+    });
+});
@@ -0,0 +1,24 @@
+import { type Observable, Subject, defer, of, race, take, tap, timer } from 'rxjs';
+
+export class LockWaiter {
+    private isWoken = false;
+    private readonly wakeUp = new Subject<void>();
+
+    wake(): void {
+        this.isWoken = true;
+        this.wakeUp.next();
+    }
+
+    /**
+     * Wait for the wake up, wake up received while waiter was not waiting is not lost.
+     *
+     * @param fallbackMs Maximal waiting time, in case wake up notification was missed
+     */
+    wait$(fallbackMs: number): Observable<unknown> {
+        return defer(() => (this.isWoken ? of(true) : race(this.wakeUp, timer(fallbackMs)).pipe(take(1)))).pipe(
+            tap(() => {
+                this.isWoken = false;
+            })
+        );
+    }
+}
@@ -1,7 +1,21 @@
+import { hostname } from 'os';
+
 import type { Settings } from 'redlock';
 
 export interface NestJSRxJSLockModuleOptions extends Settings {
     defaultExpireMs: number;
+    // Queue lock requests of the same process locally, so only one of them talks to redis
+    localQueue: boolean;
+    // Maximal number of times in a row the lock is handed off to the local queue without release
+    maxLocalHandoffs: number;
+    // Register prometheus lock metrics, labeled by lock prefix, in the default prom-client registry
+    metrics: boolean;
+    // Lock owner reported by `getHeldLocks()`
+    ownerId: string;
+    // Wait for the lock release notification instead of failing or polling redis `retryCount` times
+    waitForRelease: boolean;
+    // Maximal lock waiting time in `waitForRelease` mode
+    waitTimeoutMs: number;
 }
 
 export const defaultNestJSRxJSLockModuleOptions: NestJSRxJSLockModuleOptions = {
@@ -11,4 +25,10 @@ export const defaultNestJSRxJSLockModuleOptions: NestJSRxJSLockModuleOptions = {
     retryDelay: 200,
     retryJitter: 200,
     automaticExtensionThreshold: 500,
+    localQueue: false,
+    maxLocalHandoffs: 10,
+    metrics: false,
+    ownerId: `${hostname()}:${process.pid}`,
+    waitForRelease: false,
+    waitTimeoutMs: 10000,
 };
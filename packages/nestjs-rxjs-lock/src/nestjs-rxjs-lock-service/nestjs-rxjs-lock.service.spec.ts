@@ -1,6 +1,8 @@
 /* eslint-disable jest/no-untyped-mock-factory,jest/no-done-callback */
-import { describe, expect, it, jest } from '@jest/globals';
-import { of } from 'rxjs';
+import { EventEmitter } from 'events';
+
+import { afterEach, describe, expect, it, jest } from '@jest/globals';
+import { type Observable, Subject, lastValueFrom, of, throwError } from 'rxjs';
 
 import { emptyFn } from '@rnw-community/shared';
 
@@ -10,10 +12,16 @@ import { NestJSRxJSLockService } from './nestjs-rxjs-lock.service';
 
 import type Redis from 'ioredis';
 
+interface MockLock {
+    expiration?: number;
+    extend: () => Promise<MockLock>;
+    release: () => Promise<boolean>;
+    value?: string;
+}
+
 const mockRelease = jest.fn<() => Promise<boolean>>().mockResolvedValue(true);
-const mockAcquire = jest
-    .fn<() => Promise<{ release: () => Promise<boolean> }>>()
-    .mockResolvedValue({ release: mockRelease });
+const mockExtend = jest.fn<() => Promise<MockLock>>();
+const mockAcquire = jest.fn<() => Promise<MockLock>>().mockResolvedValue({ extend: mockExtend, release: mockRelease });
 
 jest.mock('redlock', () =>
     jest.fn().mockImplementation(() => ({
@@ -34,6 +42,29 @@ class LockService extends NestJSRxJSLockService<LockCodesEnum> {
 
 const getRedisService = (): Redis => jest.fn() as unknown as Redis;
 
+const lockName = `lock:${LockCodesEnum.DB_CREATE_USER}:test`;
+const lockTtlMs = 1000;
+const waitTimeoutMs = 10;
+const waitOptions = { ...defaultNestJSRxJSLockModuleOptions, waitForRelease: true };
+
+const getWaitRedisService = (): {
+    publish: jest.Mock;
+    redis: Redis;
+    subscriber: EventEmitter & { subscribe: jest.Mock<() => Promise<number>> };
+} => {
+    const subscriber = Object.assign(new EventEmitter(), {
+        subscribe: jest.fn<() => Promise<number>>().mockResolvedValue(1),
+        unsubscribe: jest.fn<() => Promise<number>>().mockResolvedValue(0),
+        disconnect: jest.fn(),
+    });
+    const publish = jest.fn<() => Promise<number>>().mockResolvedValue(1);
+    const pttl = jest.fn<() => Promise<number>>().mockResolvedValue(lockTtlMs);
+
+    return { publish, redis: { duplicate: () => subscriber, publish, pttl } as unknown as Redis, subscriber };
+};
+
+const flushPromises = (): Promise<void> => new Promise(resolve => void setImmediate(resolve));
+
 describe('nestJSRxJSLockService', () => {
     describe('lock$', () => {
         it('should acquire and release a lock with correct key', done => {
@@ -97,4 +128,347 @@ describe('nestJSRxJSLockService', () => {
             });
         });
     });
+
+    describe('lock$ in waitForRelease mode', () => {
+        it('should acquire busy lock after release notification and notify about own release', async () => {
+            expect.assertions(3);
+
+            jest.clearAllMocks();
+            mockRelease.mockResolvedValue(true);
+            mockAcquire.mockRejectedValueOnce(new Error('Lock is busy'));
+
+            const { publish, redis, subscriber } = getWaitRedisService();
+            const nestJSRxJSLockService = new LockService(redis, waitOptions);
+
+            const result = lastValueFrom(nestJSRxJSLockService.lock$('test', LockCodesEnum.DB_CREATE_USER, () => of(true)));
+            await flushPromises();
+            subscriber.emit('message', `${lockName}:released`, '');
+
+            await expect(result).resolves.toBe(true);
+            expect(mockAcquire).toHaveBeenNthCalledWith(2, [lockName], defaultNestJSRxJSLockModuleOptions.defaultExpireMs, {
+                retryCount: 0,
+            });
+
+            await flushPromises();
+            nestJSRxJSLockService.onModuleDestroy();
+
+            expect(publish).toHaveBeenCalledWith(`${lockName}:released`, '');
+        });
+
+        it('should make first attempt only after release channel is subscribed', async () => {
+            expect.assertions(2);
+
+            jest.clearAllMocks();
+
+            let subscribed = emptyFn;
+            const { redis, subscriber } = getWaitRedisService();
+            subscriber.subscribe.mockReturnValueOnce(new Promise(resolve => void (subscribed = () => resolve(1))));
+            const nestJSRxJSLockService = new LockService(redis, waitOptions);
+
+            const result = lastValueFrom(nestJSRxJSLockService.lock$('test', LockCodesEnum.DB_CREATE_USER, () => of(true)));
+            await flushPromises();
+
+            expect(mockAcquire).not.toHaveBeenCalled();
+
+            subscribed();
+
+            await expect(result).resolves.toBe(true);
+        });
+
+        it('should wake up next waiter after lock release', async () => {
+            expect.assertions(2);
+
+            jest.clearAllMocks();
+
+            const { redis, subscriber } = getWaitRedisService();
+            const nestJSRxJSLockService = new LockService(redis, waitOptions);
+            const firstHandler$ = new Subject<boolean>();
+
+            const lock$ = (handler$: () => Observable<boolean>): Promise<boolean> =>
+                lastValueFrom(nestJSRxJSLockService.lock$('test', LockCodesEnum.DB_CREATE_USER, handler$));
+
+            const first = lock$(() => firstHandler$);
+            const second = lock$(() => of(false));
+            await flushPromises();
+
+            expect(mockAcquire).toHaveBeenCalledTimes(1);
+
+            firstHandler$.next(true);
+            firstHandler$.complete();
+            subscriber.emit('message', `${lockName}:released`, '');
+
+            await expect(Promise.all([first, second])).resolves.toStrictEqual([true, false]);
+        });
+
+        it('should throw error if lock is not acquired in wait timeout', async () => {
+            expect.assertions(2);
+
+            jest.clearAllMocks();
+            mockAcquire.mockRejectedValueOnce(new Error('Lock is busy'));
+
+            const { redis } = getWaitRedisService();
+            const nestJSRxJSLockService = new LockService(redis, { ...waitOptions, waitTimeoutMs });
+            const handler$ = jest.fn(() => of(true));
+
+            await expect(
+                lastValueFrom(nestJSRxJSLockService.lock$('test', LockCodesEnum.DB_CREATE_USER, handler$))
+            ).rejects.toThrow(`Lock ${lockName} is not acquired in ${waitTimeoutMs}ms`);
+            expect(handler$).not.toHaveBeenCalled();
+        });
+    });
+
+    describe('lock$ with localQueue', () => {
+        const localQueueOptions = { ...defaultNestJSRxJSLockModuleOptions, localQueue: true };
+
+        const lockAll = (service: LockService, firstHandler$: Observable<number>): Promise<number[]> =>
+            Promise.all(
+                [() => firstHandler$, () => of(1), () => of(2)].map(handler$ =>
+                    lastValueFrom(service.lock$('test', LockCodesEnum.DB_CREATE_USER, handler$))
+                )
+            );
+
+        it('should acquire lock in redis once and hand it off to local waiters', async () => {
+            expect.assertions(5);
+
+            jest.clearAllMocks();
+            mockRelease.mockResolvedValue(true);
+            mockExtend.mockResolvedValue({ extend: mockExtend, release: mockRelease });
+
+            const nestJSRxJSLockService = new LockService(getRedisService(), localQueueOptions);
+            const firstHandler$ = new Subject<number>();
+
+            const results = lockAll(nestJSRxJSLockService, firstHandler$);
+            await flushPromises();
+            firstHandler$.next(0);
+            firstHandler$.complete();
+
+            await expect(results).resolves.toStrictEqual([0, 1, 2]);
+            await flushPromises();
+
+            expect(mockAcquire).toHaveBeenCalledTimes(1);
+            expect(mockExtend).toHaveBeenCalledWith(defaultNestJSRxJSLockModuleOptions.defaultExpireMs);
+            expect(mockRelease).toHaveBeenCalledTimes(1);
+            expect(nestJSRxJSLockService.getStats()).toMatchObject({ localAcquisitions: 2, remoteAcquisitions: 1 });
+        });
+
+        it('should release lock and acquire it again in redis after maxLocalHandoffs', async () => {
+            expect.assertions(3);
+
+            jest.clearAllMocks();
+
+            const nestJSRxJSLockService = new LockService(getRedisService(), { ...localQueueOptions, maxLocalHandoffs: 1 });
+
+            await expect(lockAll(nestJSRxJSLockService, of(0))).resolves.toStrictEqual([0, 1, 2]);
+            await flushPromises();
+
+            expect(mockRelease).toHaveBeenCalledTimes(2);
+            expect(nestJSRxJSLockService.getStats()).toMatchObject({ localAcquisitions: 1, remoteAcquisitions: 2 });
+        });
+
+        it('should acquire lock in redis if handed off lock is lost', async () => {
+            expect.assertions(2);
+
+            jest.clearAllMocks();
+            mockExtend.mockRejectedValueOnce(new Error('Lock is lost'));
+
+            const nestJSRxJSLockService = new LockService(getRedisService(), localQueueOptions);
+
+            await expect(lockAll(nestJSRxJSLockService, of(0))).resolves.toStrictEqual([0, 1, 2]);
+            expect(nestJSRxJSLockService.getStats()).toMatchObject({ localAcquisitions: 1, remoteAcquisitions: 2 });
+        });
+
+        it('should pass local turn if lock is not acquired', async () => {
+            expect.assertions(2);
+
+            jest.clearAllMocks();
+            mockAcquire.mockRejectedValueOnce(new Error('Lock is busy'));
+
+            const nestJSRxJSLockService = new LockService(getRedisService(), localQueueOptions);
+            const lock$ = (handler$: () => Observable<number>): Promise<number> =>
+                lastValueFrom(nestJSRxJSLockService.lock$('test', LockCodesEnum.DB_CREATE_USER, handler$));
+
+            await expect(lock$(() => throwError(() => new Error('Not called')))).rejects.toThrow('Lock is busy');
+            await expect(lock$(() => of(1))).resolves.toBe(1);
+        });
+    });
+
+    describe('lease$', () => {
+        const leaseMs = 1000;
+        const fencingToken = 5;
+        const { automaticExtensionThreshold } = defaultNestJSRxJSLockModuleOptions;
+
+        const getLeaseRedisService = (token: number | null = fencingToken): Redis =>
+            ({ eval: jest.fn<() => Promise<number | null>>().mockResolvedValue(token) }) as unknown as Redis;
+        const getLock = (): MockLock => ({ expiration: Date.now() + leaseMs, extend: mockExtend, release: mockRelease });
+
+        // eslint-disable-next-line jest/no-hooks
+        afterEach(() => {
+            jest.useRealTimers();
+        });
+
+        it('should run handler with fencing token issued for the held lock and release the lock', async () => {
+            expect.assertions(3);
+
+            jest.clearAllMocks();
+            mockRelease.mockResolvedValue(true);
+            mockAcquire.mockResolvedValueOnce({ ...getLock(), value: 'token' });
+            const redis = getLeaseRedisService();
+            const nestJSRxJSLockService = new LockService(redis, defaultNestJSRxJSLockModuleOptions);
+
+            await expect(
+                lastValueFrom(nestJSRxJSLockService.lease$('test', LockCodesEnum.DB_CREATE_USER, lease => of(lease)))
+            ).resolves.toStrictEqual({ fencingToken, lockName });
+            expect(redis.eval).toHaveBeenCalledWith(
+                expect.stringContaining("redis.call('INCR', KEYS[2])"),
+                2,
+                lockName,
+                `${lockName}:fence`,
+                'token',
+                expect.any(Number)
+            );
+            expect(mockRelease).toHaveBeenCalledTimes(1);
+        });
+
+        it('should not run handler if lock is lost before fencing token is issued', async () => {
+            expect.assertions(3);
+
+            jest.clearAllMocks();
+            mockRelease.mockResolvedValue(true);
+            const nestJSRxJSLockService = new LockService(getLeaseRedisService(null), defaultNestJSRxJSLockModuleOptions);
+            const handler$ = jest.fn(() => of(true));
+
+            await expect(
+                lastValueFrom(nestJSRxJSLockService.lease$('test', LockCodesEnum.DB_CREATE_USER, handler$))
+            ).rejects.toThrow(`Lock ${lockName} lease is lost`);
+            expect(handler$).not.toHaveBeenCalled();
+            expect(mockRelease).toHaveBeenCalledTimes(1);
+        });
+
+        it('should extend lease not longer than extension threshold when half of its time is left', async () => {
+            expect.assertions(2);
+
+            jest.clearAllMocks();
+            jest.useFakeTimers();
+            const getShortLock = (): MockLock => ({
+                expiration: Date.now() + automaticExtensionThreshold,
+                extend: mockExtend,
+                release: mockRelease,
+            });
+            mockAcquire.mockResolvedValueOnce(getShortLock());
+            mockExtend.mockImplementation(() => Promise.resolve(getShortLock()));
+            const nestJSRxJSLockService = new LockService(getLeaseRedisService(), defaultNestJSRxJSLockModuleOptions);
+            const handler$ = new Subject<number>();
+
+            const result = lastValueFrom(
+                nestJSRxJSLockService.lease$(
+                    'test',
+                    LockCodesEnum.DB_CREATE_USER,
+                    () => handler$,
+                    automaticExtensionThreshold
+                )
+            );
+            await jest.advanceTimersByTimeAsync(automaticExtensionThreshold);
+            handler$.next(1);
+            handler$.complete();
+
+            await expect(result).resolves.toBe(1);
+            expect(mockExtend).toHaveBeenCalledTimes(2);
+        });
+
+        it('should extend the lock while handler is running', async () => {
+            expect.assertions(4);
+
+            jest.clearAllMocks();
+            jest.useFakeTimers();
+            mockAcquire.mockResolvedValueOnce(getLock());
+            mockExtend.mockImplementation(() => Promise.resolve(getLock()));
+            const nestJSRxJSLockService = new LockService(getLeaseRedisService(), defaultNestJSRxJSLockModuleOptions);
+            const handler$ = new Subject<number>();
+
+            const result = lastValueFrom(
+                nestJSRxJSLockService.lease$('test', LockCodesEnum.DB_CREATE_USER, () => handler$, leaseMs)
+            );
+            await jest.advanceTimersByTimeAsync(leaseMs - automaticExtensionThreshold);
+
+            expect(mockExtend).toHaveBeenCalledWith(leaseMs);
+
+            await jest.advanceTimersByTimeAsync(leaseMs - automaticExtensionThreshold);
+            handler$.next(1);
+            handler$.complete();
+
+            await expect(result).resolves.toBe(1);
+            expect(mockRelease).toHaveBeenCalledTimes(1);
+            expect(nestJSRxJSLockService.getStats()).toMatchObject({ expirations: 0, extensions: 2 });
+        });
+
+        it('should stop handler with an error if lease is lost', async () => {
+            expect.assertions(2);
+
+            jest.clearAllMocks();
+            jest.useFakeTimers();
+            mockAcquire.mockResolvedValueOnce(getLock());
+            mockExtend.mockRejectedValueOnce(new Error('Lock is lost'));
+            const nestJSRxJSLockService = new LockService(getLeaseRedisService(), defaultNestJSRxJSLockModuleOptions);
+
+            const result = lastValueFrom(
+                nestJSRxJSLockService.lease$('test', LockCodesEnum.DB_CREATE_USER, () => new Subject<number>(), leaseMs)
+            );
+            const expectation = expect(result).rejects.toThrow(`Lock ${lockName} lease is lost`);
+            await jest.advanceTimersByTimeAsync(leaseMs);
+
+            await expectation;
+            expect(nestJSRxJSLockService.getStats()).toMatchObject({ expirations: 1, extensions: 0 });
+        });
+    });
+
+    describe('getHeldLocks', () => {
+        it('should list locks held by handlers until they are released', async () => {
+            expect.assertions(3);
+
+            jest.clearAllMocks();
+            mockRelease.mockResolvedValue(true);
+            mockAcquire.mockResolvedValueOnce({
+                expiration: lockTtlMs,
+                extend: mockExtend,
+                release: mockRelease,
+                value: 'token',
+            });
+            const nestJSRxJSLockService = new LockService(getRedisService(), defaultNestJSRxJSLockModuleOptions);
+            const handler$ = new Subject<boolean>();
+
+            const result = lastValueFrom(nestJSRxJSLockService.lock$('test', LockCodesEnum.DB_CREATE_USER, () => handler$));
+            await flushPromises();
+
+            expect(nestJSRxJSLockService.getHeldLocks()).toStrictEqual([
+                {
+                    acquiredAt: expect.any(Number),
+                    expiresAt: lockTtlMs,
+                    lockName,
+                    owner: defaultNestJSRxJSLockModuleOptions.ownerId,
+                },
+            ]);
+
+            handler$.next(true);
+            handler$.complete();
+
+            await expect(result).resolves.toBe(true);
+            expect(nestJSRxJSLockService.getHeldLocks()).toStrictEqual([]);
+        });
+
+        it('should count failed acquisition attempts as contentions', async () => {
+            expect.assertions(2);
+
+            jest.clearAllMocks();
+            mockAcquire.mockRejectedValueOnce(new Error('Lock is busy'));
+            const nestJSRxJSLockService = new LockService(getRedisService(), {
+                ...defaultNestJSRxJSLockModuleOptions,
+                metrics: true,
+            });
+
+            await expect(
+                lastValueFrom(nestJSRxJSLockService.lock$('test', LockCodesEnum.DB_CREATE_USER, () => of(true)))
+            ).rejects.toThrow('Lock is busy');
+            expect(nestJSRxJSLockService.getStats()).toMatchObject({ contentions: 1, remoteAcquisitions: 0 });
+        });
+    });
 });
@@ -1,30 +1,108 @@
 import { InjectRedis } from '@nestjs-modules/ioredis';
 import { Redis } from 'ioredis';
-import Redlock from 'redlock';
-import { type Observable, concatMap, finalize, from } from 'rxjs';
+import Redlock, { type Lock } from 'redlock';
+import {
+    type Observable,
+    catchError,
+    concatMap,
+    defer,
+    finalize,
+    from,
+    of,
+    retry,
+    tap,
+    throwError,
+    timeout,
+} from 'rxjs';
 
-import { isNotEmptyString } from '@rnw-community/shared';
+import { isDefined, isNotEmptyString } from '@rnw-community/shared';
 
+import { LocalLockQueue } from '../local-lock-queue/local-lock-queue';
+import { extendLockWhile$ } from '../lock-lease/extend-lock-while';
+import { issueFencingToken } from '../lock-lease/issue-fencing-token';
+import { LockMonitor } from '../lock-monitor/lock-monitor';
+import { LockReleaseNotifier } from '../lock-release-notifier/lock-release-notifier';
+
+import type { NestJSRxJSHeldLockInterface } from '../interface/nestjs-rxjs-held-lock.interface';
+import type { NestJSRxJSLockLeaseInterface } from '../interface/nestjs-rxjs-lock-lease.interface';
+import type { NestJSRxJSLockStatsInterface } from '../interface/nestjs-rxjs-lock-stats.interface';
 // eslint-disable-next-line @typescript-eslint/consistent-type-imports
 import type { NestJSRxJSLockModuleOptions } from '../nestjs-rxjs-lock-module.options';
+import type { LockMetrics } from '../lock-monitor/lock-metrics';
+import type { LockTracker } from '../lock-monitor/lock-tracker';
+import type { OnModuleDestroy } from '@nestjs/common';
+
+// HINT: prom-client is an optional peer dependency, it is loaded only when metrics are enabled
+const loadLockMetrics = (): LockMetrics => {
+    // eslint-disable-next-line @typescript-eslint/no-require-imports,@typescript-eslint/no-var-requires
+    const { createLockMetrics } = require('../lock-monitor/lock-metrics') as { createLockMetrics: () => LockMetrics };
 
-export abstract class NestJSRxJSLockService<E = string> {
+    return createLockMetrics();
+};
+
+export abstract class NestJSRxJSLockService<E = string> implements OnModuleDestroy {
     private readonly lock: Redlock;
     private readonly expireInMs: number;
+    private readonly releaseNotifier?: LockReleaseNotifier;
+    private readonly localQueue?: LocalLockQueue;
+    private readonly monitor: LockMonitor;
 
     protected constructor(
         @InjectRedis() readonly redis: Redis,
         readonly options: NestJSRxJSLockModuleOptions
     ) {
-        const { defaultExpireMs, ...redlockOptions } = options;
+        const {
+            defaultExpireMs,
+            localQueue,
+            maxLocalHandoffs,
+            metrics,
+            ownerId,
+            waitForRelease,
+            waitTimeoutMs,
+            ...redlockOptions
+        } = options;
         this.expireInMs = options.defaultExpireMs;
 
         this.lock = new Redlock([redis], redlockOptions);
+        this.monitor = new LockMonitor(ownerId, metrics ? loadLockMetrics() : undefined);
+
+        if (waitForRelease) {
+            this.releaseNotifier = new LockReleaseNotifier(redis);
+        }
+
+        if (localQueue) {
+            this.localQueue = new LocalLockQueue(maxLocalHandoffs);
+        }
+    }
+
+    onModuleDestroy(): void {
+        this.releaseNotifier?.close();
+    }
+
+    /**
+     * Lock acquisition statistics.
+     *
+     * @returns NestJSRxJSLockStatsInterface Number of locks handed off locally and acquired in redis,
+     * number of contentions, lease extensions and lost locks
+     */
+    getStats(): NestJSRxJSLockStatsInterface {
+        return this.monitor.getStats();
+    }
+
+    /**
+     * Locks currently held by this process, e.g. to find long-running critical sections.
+     */
+    getHeldLocks(): NestJSRxJSHeldLockInterface[] {
+        return this.monitor.getHeldLocks();
     }
 
     /**
      * RxJS wrapper for redlock acquire lock method
      *
+     * In `waitForRelease` mode busy lock is acquired right after its release notification,
+     * or fails if it is not acquired in `waitTimeoutMs`. With `localQueue` lock requests of this process wait
+     * for their turn locally and the lock is handed off to the next of them instead of the release.
+     *
      * @see https://www.npmjs.com/package/redlock
      *
      * @param name Redis lock key name
@@ -34,13 +112,184 @@ export abstract class NestJSRxJSLockService<E = string> {
      * @returns Observable<T> returned from handler$
      */
     lock$<T>(name: string, prefix: E, handler$: () => Observable<T>, expireInMs = this.expireInMs): Observable<T> {
+        return this.run$(name, prefix, () => handler$(), expireInMs);
+    }
+
+    /**
+     * Hold the lock while handler$ observable is subscribed, `using`-style.
+     *
+     * Lock is extended by `leaseMs` when less than `automaticExtensionThreshold` is left before its expiration,
+     * and released when handler$ completes, errors or is unsubscribed. If extension fails the lock could be taken
+     * by someone else, so handler$ is stopped with an error.
+     *
+     * Handler receives a fencing token, increased by every lock holder and issued only while the lock is held,
+     * so storage can reject writes of a holder which lost the lock, e.g. after a long GC pause.
+     *
+     * @see https://martin.kleppmann.com/2016/02/08/how-to-do-distributed-locking.html
+     *
+     * @param name Redis lock key name
+     * @param prefix Redis lock key prefix
+     * @param handler$ Observable handler with business logic to be executed under lock
+     * @param leaseMs Lock expiration and extension time in milliseconds, default option is used if not provided
+     * @returns Observable<T> returned from handler$
+     */
+    lease$<T>(
+        name: string,
+        prefix: E,
+        handler$: (lease: NestJSRxJSLockLeaseInterface) => Observable<T>,
+        leaseMs = this.expireInMs
+    ): Observable<T> {
+        return this.run$(
+            name,
+            prefix,
+            (held, lock) => this.extendWhile$(held, leaseMs, this.fence$(held.lockName, lock, handler$)),
+            leaseMs
+        );
+    }
+
+    // eslint-disable-next-line @typescript-eslint/max-params
+    private run$<T>(
+        name: string,
+        prefix: E,
+        handler$: (held: LockTracker, lock: Lock) => Observable<T>,
+        expireInMs: number
+    ): Observable<T> {
         const lockName = NestJSRxJSLockService.generateName(name, prefix);
 
-        return from(this.lock.acquire([lockName], expireInMs)).pipe(
-            concatMap(lock => handler$().pipe(finalize(() => void lock.release().catch(() => void 0))))
+        return defer(() => {
+            const tracker = this.monitor.track(lockName, isNotEmptyString(prefix) ? prefix : '');
+
+            if (this.localQueue?.isBusy(lockName) === true) {
+                tracker.contended();
+            }
+
+            return (this.localQueue?.turn$(lockName) ?? of(null)).pipe(
+                concatMap(handedOffLock => this.hold$(tracker, handedOffLock, handler$, expireInMs))
+            );
+        });
+    }
+
+    private fence$<T>(
+        lockName: string,
+        lock: Lock,
+        handler$: (lease: NestJSRxJSLockLeaseInterface) => Observable<T>
+    ): Observable<T> {
+        return from(issueFencingToken(this.redis, lockName, lock)).pipe(
+            concatMap(fencingToken =>
+                isDefined(fencingToken)
+                    ? handler$({ fencingToken, lockName })
+                    : throwError(() => new Error(`Lock ${lockName} lease is lost`))
+            )
+        );
+    }
+
+    private extendWhile$<T>(held: LockTracker, leaseMs: number, source$: Observable<T>): Observable<T> {
+        return extendLockWhile$(source$, {
+            expiration: () => held.lock?.expiration ?? 0,
+            extend: () => held.extend(leaseMs),
+            extensionThreshold: this.options.automaticExtensionThreshold,
+            onLost: () => {
+                held.lost();
+
+                return new Error(`Lock ${held.lockName} lease is lost`);
+            },
+        });
+    }
+
+    /**
+     * Hold the lock while handler$ is running, then hand it off to the local queue or release it.
+     */
+    private hold$<T>(
+        tracker: LockTracker,
+        handedOffLock: Lock | null,
+        handler$: (held: LockTracker, lock: Lock) => Observable<T>,
+        expireInMs: number
+    ): Observable<T> {
+        let isLeft = false;
+        const leave = (): void => {
+            if (!isLeft) {
+                isLeft = true;
+                tracker.released();
+                this.leave(tracker.lockName, tracker.lock);
+            }
+        };
+
+        // HINT: Handed off lock extension succeeds only if it is still owned, otherwise lock is acquired again
+        const lock$ = isDefined(handedOffLock)
+            ? from(handedOffLock.extend(expireInMs)).pipe(
+                  tap(lock => void tracker.acquired(lock, true)),
+                  catchError(() => {
+                      tracker.lost();
+
+                      return this.acquire$(tracker, expireInMs);
+                  })
+              )
+            : this.acquire$(tracker, expireInMs);
+
+        return lock$.pipe(
+            concatMap(lock => handler$(tracker, lock).pipe(finalize(leave))),
+            finalize(leave)
         );
     }
 
+    private leave(lockName: string, lock: Lock | null): void {
+        if (isDefined(lock) && this.localQueue?.canHandOff(lockName) === true) {
+            this.localQueue.next(lockName, lock);
+
+            return;
+        }
+
+        const release = isDefined(lock) ? this.release(lockName, lock).catch(() => void 0) : Promise.resolve();
+
+        void release.then(() => void this.localQueue?.next(lockName, null));
+    }
+
+    private acquire$(tracker: LockTracker, expireInMs: number): Observable<Lock> {
+        return (
+            isDefined(this.releaseNotifier)
+                ? this.waitAndAcquire$(tracker, expireInMs, this.releaseNotifier)
+                : tracker.attempt$(() => this.lock.acquire([tracker.lockName], expireInMs))
+        ).pipe(tap(lock => void tracker.acquired(lock, false)));
+    }
+
+    private waitAndAcquire$(tracker: LockTracker, expireInMs: number, notifier: LockReleaseNotifier): Observable<Lock> {
+        const { waitTimeoutMs } = this.options;
+        const { lockName } = tracker;
+
+        return defer(() => {
+            const waiter = notifier.join(lockName);
+            let isAcquired = false;
+
+            const attempt$ = tracker.attempt$(() => this.lock.acquire([lockName], expireInMs, { retryCount: 0 }));
+            // HINT: Lock expiration is a fallback for missed release notifications, e.g. when lock owner has crashed
+            const wait$ = (): Observable<unknown> =>
+                from(this.redis.pttl(lockName)).pipe(concatMap(ttl => waiter.wait$(Math.max(ttl, 0))));
+
+            if (!notifier.isHead(lockName, waiter)) {
+                tracker.contended();
+            }
+
+            // HINT: First attempt is made only after release channel is subscribed, so its failure cannot miss the release
+            return from(notifier.subscribed(lockName)).pipe(
+                concatMap(() => (notifier.isHead(lockName, waiter) ? attempt$ : wait$().pipe(concatMap(() => attempt$)))),
+                retry({ delay: wait$ }),
+                timeout({
+                    first: waitTimeoutMs,
+                    with: () => throwError(() => new Error(`Lock ${lockName} is not acquired in ${waitTimeoutMs}ms`)),
+                }),
+                tap(() => {
+                    isAcquired = true;
+                }),
+                finalize(() => void notifier.leave(lockName, waiter, isAcquired))
+            );
+        });
+    }
+
+    private async release(lockName: string, lock: Lock): Promise<void> {
+        await lock.release();
+        await this.releaseNotifier?.notify(lockName);
+    }
+
     // eslint-disable-next-line @typescript-eslint/no-unnecessary-type-parameters
     private static generateName<E>(name: string, prefix: E): string {
         return ['lock', prefix, name].filter(isNotEmptyString).join(':');
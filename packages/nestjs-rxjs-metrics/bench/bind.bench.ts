@@ -0,0 +1,97 @@
+import { describe, expect, it } from '@jest/globals';
+import { Counter, Gauge, Histogram, Registry, Summary } from 'prom-client';
+import { type MonoTypeOperatorFunction, type Observable, identity, of, range } from 'rxjs';
+
+import { isDefined } from '@rnw-community/shared';
+
+import { NestJSRxJSMetricsService } from '../src/nestjs-rxjs-metrics-service/nestjs-rxjs-metrics.service';
+
+const EVENTS = 1e6;
+const SUBSCRIPTIONS = 1e5;
+const FLUSH_INTERVAL_MS = 1000;
+
+const metrics = { bench_metric: 'Bench metric' };
+const labels = { bench_metric: ['route', 'status'] as const };
+
+const registers = [new Registry()];
+const counter = new Counter({ name: 'bench_counter', help: 'counter', registers });
+const gauge = new Gauge({ name: 'bench_gauge', help: 'gauge', registers });
+const histogram = new Histogram({ name: 'bench_histogram', help: 'histogram', labelNames: labels.bench_metric, registers });
+const service = new NestJSRxJSMetricsService<typeof metrics, typeof metrics, typeof metrics, typeof metrics, typeof labels>(
+    { bench_metric: counter },
+    { bench_metric: gauge },
+    { bench_metric: histogram },
+    { bench_metric: new Summary({ name: 'bench_summary', help: 'summary', registers }) }
+);
+
+const getMetricValue = async (
+    metric: { get: () => Promise<{ values: Array<{ metricName?: string; value: number }> }> },
+    metricName?: string
+): Promise<number> =>
+    (await metric.get()).values
+        .filter(value => !isDefined(metricName) || value.metricName === metricName)
+        .reduce((sum, { value }) => sum + value, 0);
+
+// HINT: Run all events through the operator in one subscription, like a hot stream
+const measureEventNs = (operator: (source$: Observable<number>) => Observable<number>): number => {
+    const start = process.hrtime.bigint();
+    range(0, EVENTS).pipe(operator).subscribe();
+
+    return Math.round(Number(process.hrtime.bigint() - start) / EVENTS);
+};
+
+const measureSubscriptionNs = (operator: MonoTypeOperatorFunction<number>): number => {
+    const start = process.hrtime.bigint();
+    for (let idx = 0; idx < SUBSCRIPTIONS; idx++) {
+        of(idx).pipe(operator).subscribe();
+    }
+
+    return Math.round(Number(process.hrtime.bigint() - start) / SUBSCRIPTIONS);
+};
+
+describe('NestJSRxJSMetricsService bound operators', () => {
+    it('per-event overhead', async () => {
+        const baseline = measureEventNs(identity);
+        const results = [
+            { operator: 'no metric', 'ns/event': baseline },
+            { operator: 'counter()', 'ns/event': measureEventNs(service.counter('bench_metric')) },
+            { operator: 'bindCounter()', 'ns/event': measureEventNs(service.bindCounter('bench_metric')) },
+            {
+                operator: 'bindCounter() accumulated',
+                'ns/event': measureEventNs(
+                    service.bindCounter('bench_metric', {}, 1, { flushIntervalMs: FLUSH_INTERVAL_MS })
+                ),
+            },
+            { operator: 'gaugeInc()', 'ns/event': measureEventNs(service.gaugeInc('bench_metric')) },
+            { operator: 'bindGauge()', 'ns/event': measureEventNs(service.bindGauge('bench_metric')) },
+        ];
+        service.onModuleDestroy();
+
+        // HINT: Every measured operator must have counted every event, accumulated values are flushed on destroy
+        await expect(getMetricValue(counter)).resolves.toBe(3 * EVENTS);
+        await expect(getMetricValue(gauge)).resolves.toBe(2 * EVENTS);
+
+        // eslint-disable-next-line no-console
+        console.table(results);
+    });
+
+    it('per-subscription timer overhead with labels', async () => {
+        const histogramLabels = { route: '/cats', status: 'success' };
+        const results = [
+            { operator: 'no metric', 'ns/subscription': measureSubscriptionNs(identity) },
+            {
+                operator: 'histogram$()',
+                'ns/subscription': measureSubscriptionNs(service.histogram$('bench_metric', histogramLabels)),
+            },
+            {
+                operator: 'bindHistogram()',
+                'ns/subscription': measureSubscriptionNs(service.bindHistogram('bench_metric', histogramLabels)),
+            },
+        ];
+
+        await expect(getMetricValue(histogram, 'bench_histogram_count')).resolves.toBe(2 * SUBSCRIPTIONS);
+
+        // eslint-disable-next-line no-console
+        console.table(results);
+    });
+});
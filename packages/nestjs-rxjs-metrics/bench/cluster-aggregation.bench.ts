@@ -0,0 +1,102 @@
+import cluster from 'cluster';
+import { get } from 'http';
+import { join } from 'path';
+
+import { describe, expect, it } from '@jest/globals';
+
+import { elapsedMs } from '../../../bench/benchmark';
+import { ClusterMetricsAggregator } from '../src/cluster/cluster-metrics-aggregator';
+import { isClusterMetricsMessage } from '../src/cluster/cluster-metrics.message';
+
+import type { AddressInfo } from 'net';
+
+const EVENTS_PER_WORKER = 100000;
+const PUSH_INTERVAL_MS = 100;
+const POLL_INTERVAL_MS = 50;
+const TIMEOUT_MS = 30000;
+const SCRAPES = 100;
+
+const workerCounts = [2, 4, 8];
+
+const scrape = (port: number): Promise<string> =>
+    new Promise((resolve, reject) => {
+        get({ path: '/metrics', port }, response => {
+            let body = '';
+            response.on('data', (chunk: Buffer) => {
+                body += chunk.toString();
+            });
+            response.on('end', () => void resolve(body));
+        }).on('error', reject);
+    });
+
+const eventsTotal = (metrics: string): number =>
+    metrics
+        .split('\n')
+        .filter(line => line.startsWith('bench_events_total{'))
+        .reduce((sum, line) => sum + Number(line.split(' ')[1]), 0);
+
+const waitForEvents = async (port: number, expected: number): Promise<void> => {
+    const startedAt = Date.now();
+
+    while (eventsTotal(await scrape(port)) < expected) {
+        if (Date.now() - startedAt > TIMEOUT_MS) {
+            throw new Error(`Workers metrics are not aggregated in ${TIMEOUT_MS}ms`);
+        }
+        await new Promise(resolve => void setTimeout(resolve, POLL_INTERVAL_MS));
+    }
+};
+
+// HINT: Forks real cluster workers, each of them pushes metrics to this process acting as cluster primary
+describe('Cluster metrics aggregation', () => {
+    it('workers push metrics deltas, primary serves merged metrics', async () => {
+        const results = [];
+
+        cluster.setupPrimary({
+            exec: join(__dirname, 'cluster/worker.js'),
+            args: [String(EVENTS_PER_WORKER), String(PUSH_INTERVAL_MS)],
+        });
+
+        for (const workerCount of workerCounts) {
+            const aggregator = new ClusterMetricsAggregator();
+            let pushedBytes = 0;
+            let pushes = 0;
+            const onMessage = (_worker: unknown, message: unknown): void => {
+                if (isClusterMetricsMessage(message)) {
+                    pushedBytes += Buffer.byteLength(message.batch, 'base64');
+                    pushes++;
+                }
+            };
+            cluster.on('message', onMessage);
+            aggregator.attach(cluster);
+            const { port } = (await aggregator.listen(0)).address() as AddressInfo;
+
+            const workers = Array.from({ length: workerCount }, () => cluster.fork());
+            await waitForEvents(port, workerCount * EVENTS_PER_WORKER);
+
+            const start = process.hrtime.bigint();
+            for (let idx = 0; idx < SCRAPES; idx++) {
+                await scrape(port);
+            }
+            const scrapeMs = elapsedMs(start) / SCRAPES;
+
+            expect(eventsTotal(await scrape(port))).toBe(workerCount * EVENTS_PER_WORKER);
+
+            await Promise.all(
+                workers.map(worker => new Promise(resolve => void worker.on('exit', resolve).process.kill()))
+            );
+            cluster.removeAllListeners('message');
+            cluster.removeAllListeners('exit');
+            await aggregator.close();
+
+            results.push({
+                workers: workerCount,
+                pushes,
+                'bytes/push': Math.round(pushedBytes / pushes),
+                'scrape ms': scrapeMs,
+            });
+        }
+
+        // eslint-disable-next-line no-console
+        console.table(results);
+    }, TIMEOUT_MS * workerCounts.length);
+});
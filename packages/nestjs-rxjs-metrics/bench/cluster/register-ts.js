@@ -0,0 +1,10 @@
+// HINT: Forked cluster workers are plain node processes, compile TypeScript sources with the package babel config
+const { join } = require('path');
+
+const { transformFileSync } = require('@babel/core');
+
+const cwd = join(__dirname, '../..');
+
+require.extensions['.ts'] = (module, filename) => {
+    module._compile(transformFileSync(filename, { cwd }).code, filename);
+};
@@ -0,0 +1,29 @@
+require('./register-ts');
+
+const { Counter, Histogram } = require('prom-client');
+
+const { ClusterMetricsReporter } = require('../../src/cluster/cluster-metrics-reporter');
+
+const [events, pushIntervalMs] = process.argv.slice(2).map(Number);
+const BATCH_SIZE = 100;
+
+const counter = new Counter({ name: 'bench_events_total', help: 'Bench events', labelNames: ['worker'] });
+const histogram = new Histogram({ name: 'bench_event_duration_seconds', help: 'Bench event duration' });
+const reporter = new ClusterMetricsReporter(pushIntervalMs);
+
+reporter.onModuleInit();
+
+// HINT: Emit events in batches, so they are spread over several pushes
+let emitted = 0;
+const emit = () => {
+    for (let idx = 0; idx < BATCH_SIZE && emitted < events; idx++, emitted++) {
+        counter.inc({ worker: String(process.pid % 2) });
+        histogram.observe(Math.random());
+    }
+
+    if (emitted < events) {
+        setImmediate(emit);
+    }
+};
+
+emit();
@@ -0,0 +1,195 @@
+import { EventEmitter } from 'events';
+import { get } from 'http';
+
+import { describe, expect, it, jest } from '@jest/globals';
+import { Logger } from '@nestjs/common';
+
+import { emptyFn } from '@rnw-community/shared';
+
+import { ClusterMetricsAggregator } from './cluster-metrics-aggregator';
+import { CLUSTER_METRICS_MESSAGE_TYPE } from './cluster-metrics.message';
+import { encodeMetricsBatch } from './metrics-batch.codec';
+
+import type { MetricsBatch, MetricsBatchAggregator } from '../type/metrics-batch.type';
+import type { Cluster } from 'cluster';
+import type { AddressInfo } from 'net';
+
+const counterBatch = (delta: number): MetricsBatch => [
+    {
+        aggregator: 'sum',
+        help: 'Requests\nline',
+        name: 'requests_total',
+        type: 'counter',
+        values: [{ delta, labels: { route: '/"cats"' }, series: 'requests_total' }],
+    },
+];
+
+const gaugeBatch = (delta: number): MetricsBatch => [
+    {
+        aggregator: 'sum',
+        help: 'Connections',
+        name: 'connections',
+        type: 'gauge',
+        values: [{ delta, labels: {}, series: 'connections' }],
+    },
+];
+
+const aggregatedGaugeBatch = (aggregator: MetricsBatchAggregator, value: number): MetricsBatch => [
+    {
+        aggregator,
+        help: aggregator,
+        name: `gauge_${aggregator}`,
+        type: 'gauge',
+        values: [{ delta: value, labels: {}, series: `gauge_${aggregator}` }],
+    },
+];
+
+const toMessage = (batch: Buffer): unknown => ({ batch: batch.toString('base64'), type: CLUSTER_METRICS_MESSAGE_TYPE });
+
+const request = (port: number, path: string): Promise<{ body: string; statusCode?: number }> =>
+    new Promise((resolve, reject) => {
+        get({ path, port }, response => {
+            let body = '';
+            response.on('data', (chunk: Buffer) => {
+                body += chunk.toString();
+            });
+            response.on('end', () => void resolve({ body, statusCode: response.statusCode }));
+        }).on('error', reject);
+    });
+
+describe('ClusterMetricsAggregator', () => {
+    it('should merge batches of all workers', () => {
+        expect.assertions(1);
+
+        const aggregator = new ClusterMetricsAggregator();
+        aggregator.apply(1, [...counterBatch(2), ...gaugeBatch(3)]);
+        aggregator.apply(2, [...counterBatch(1), ...gaugeBatch(4)]);
+
+        expect(aggregator.render()).toBe(
+            [
+                '# HELP requests_total Requests\\nline',
+                '# TYPE requests_total counter',
+                'requests_total{route="/\\"cats\\""} 3',
+                '',
+                '# HELP connections Connections',
+                '# TYPE connections gauge',
+                'connections 7',
+                '',
+            ].join('\n')
+        );
+    });
+
+    it('should remove gauge values of exited worker and keep counters', () => {
+        expect.assertions(4);
+
+        const aggregator = new ClusterMetricsAggregator();
+        const cluster = new EventEmitter() as unknown as Cluster;
+        const message = (batch: MetricsBatch): unknown => toMessage(encodeMetricsBatch(batch));
+        aggregator.attach(cluster);
+
+        cluster.emit('message', { id: 1 }, message([...counterBatch(2), ...gaugeBatch(3)]));
+        cluster.emit('message', { id: 2 }, message(gaugeBatch(4)));
+        cluster.emit('message', { id: 2 }, { type: 'other' });
+
+        expect(aggregator.render()).toContain('connections 7');
+
+        cluster.emit('exit', { id: 1 });
+
+        expect(aggregator.render()).toContain('requests_total{route="/\\"cats\\""} 2\n');
+        expect(aggregator.render()).toContain('connections 4\n');
+
+        cluster.emit('exit', { id: 2 });
+
+        expect(aggregator.render()).toContain('# TYPE connections gauge\n\n');
+    });
+
+    it('should log and drop malformed batches and keep serving metrics', () => {
+        expect.assertions(3);
+
+        const warn = jest.spyOn(Logger.prototype, 'warn').mockImplementation(emptyFn);
+        const aggregator = new ClusterMetricsAggregator();
+        const cluster = new EventEmitter() as unknown as Cluster;
+        // HINT: Batch of a worker with older codec format version
+        const legacyBatch = encodeMetricsBatch(counterBatch(1));
+        legacyBatch[0] = 1;
+        aggregator.attach(cluster);
+
+        cluster.emit('message', { id: 1 }, toMessage(legacyBatch));
+        cluster.emit('message', { id: 2 }, toMessage(encodeMetricsBatch(gaugeBatch(4))));
+
+        expect(warn).toHaveBeenCalledWith(
+            'Error applying metrics batch of worker 1: Unsupported metrics batch format version 1'
+        );
+        expect(aggregator.render()).not.toContain('requests_total');
+        expect(aggregator.render()).toContain('connections 4\n');
+
+        warn.mockRestore();
+    });
+
+    it('should merge worker values with metric aggregator', () => {
+        expect.assertions(5);
+
+        const aggregator = new ClusterMetricsAggregator();
+        const aggregators: MetricsBatchAggregator[] = ['average', 'first', 'max', 'min', 'omit'];
+        aggregator.apply(1, aggregators.flatMap(name => aggregatedGaugeBatch(name, 2)));
+        aggregator.apply(2, aggregators.flatMap(name => aggregatedGaugeBatch(name, 6)));
+
+        expect(aggregator.render()).toContain('gauge_average 4\n');
+        expect(aggregator.render()).toContain('gauge_first 2\n');
+        expect(aggregator.render()).toContain('gauge_max 6\n');
+        expect(aggregator.render()).toContain('gauge_min 2\n');
+        expect(aggregator.render()).not.toContain('gauge_omit');
+    });
+
+    it('should render histogram buckets of every label set in le order', () => {
+        expect.assertions(1);
+
+        const aggregator = new ClusterMetricsAggregator();
+        const histogramBatch = (route: string, les: string[]): MetricsBatch => [
+            {
+                aggregator: 'sum',
+                help: 'Duration',
+                name: 'duration',
+                type: 'histogram',
+                values: [
+                    { delta: 1, labels: { route }, series: 'duration_count' },
+                    ...les.map(le => ({ delta: 1, labels: { le, route }, series: 'duration_bucket' })),
+                    { delta: 1, labels: { route }, series: 'duration_sum' },
+                ],
+            },
+        ];
+        aggregator.apply(1, histogramBatch('b', ['+Inf', '10']));
+        aggregator.apply(2, histogramBatch('a', ['10']));
+        aggregator.apply(1, histogramBatch('b', ['0.5']));
+
+        expect(aggregator.render().split('\n').slice(2, -1)).toStrictEqual([
+            'duration_bucket{le="10",route="a"} 1',
+            'duration_sum{route="a"} 1',
+            'duration_count{route="a"} 1',
+            'duration_bucket{le="0.5",route="b"} 1',
+            'duration_bucket{le="10",route="b"} 1',
+            'duration_bucket{le="+Inf",route="b"} 1',
+            'duration_sum{route="b"} 2',
+            'duration_count{route="b"} 2',
+        ]);
+    });
+
+    it('should serve aggregated metrics over http', async () => {
+        expect.assertions(3);
+
+        const aggregator = new ClusterMetricsAggregator();
+        aggregator.apply(1, counterBatch(1));
+        const server = await aggregator.listen(0);
+        const { port } = server.address() as AddressInfo;
+
+        await expect(request(port, '/metrics')).resolves.toStrictEqual({ body: aggregator.render(), statusCode: 200 });
+        await expect(request(port, '/other')).resolves.toStrictEqual({ body: '', statusCode: 404 });
+        await expect(aggregator.close()).resolves.toBeUndefined();
+    });
+
+    it('should close without server', async () => {
+        expect.assertions(1);
+
+        await expect(new ClusterMetricsAggregator().close()).resolves.toBeUndefined();
+    });
+});
@@ -0,0 +1,184 @@
+import { type Server, createServer } from 'http';
+
+import { Logger } from '@nestjs/common';
+
+import { getErrorMessage } from '@rnw-community/shared';
+
+import { seriesKey } from '../util/series-key.util';
+
+import { isClusterMetricsMessage } from './cluster-metrics.message';
+import { decodeMetricsBatch } from './metrics-batch.codec';
+
+import type { MetricsBatch, MetricsBatchAggregator, MetricsBatchMetricType } from '../type/metrics-batch.type';
+import type { Cluster, Worker } from 'cluster';
+
+interface AggregatedSeries {
+    labels: Record<string, string>;
+    series: string;
+    // HINT: Value of every worker, merged on render with the metric aggregator
+    workers: Map<number, number>;
+}
+
+type SeriesAggregator = Exclude<MetricsBatchAggregator, 'omit'>;
+
+interface AggregatedMetric {
+    aggregator: SeriesAggregator;
+    help: string;
+    series: Map<string, AggregatedSeries>;
+    type: MetricsBatchMetricType;
+}
+
+const HTTP_OK = 200;
+const HTTP_NOT_FOUND = 404;
+const CONTENT_TYPE = 'text/plain; version=0.0.4; charset=utf-8';
+
+const escapeHelp = (help: string): string => help.replace(/\\/gu, '\\\\').replace(/\n/gu, '\\n');
+const escapeLabel = (value: string): string => escapeHelp(value).replace(/"/gu, '\\"');
+
+const HISTOGRAM_SERIES_SUFFIXES = ['_bucket', '_sum', '_count'];
+
+const sum = (values: number[]): number => values.reduce((total, value) => total + value, 0);
+
+const aggregators: Record<SeriesAggregator, (values: number[]) => number> = {
+    average: values => sum(values) / values.length,
+    first: ([value]) => value,
+    max: values => Math.max(...values),
+    min: values => Math.min(...values),
+    sum,
+};
+
+const getSuffixIndex = ({ series }: AggregatedSeries): number =>
+    HISTOGRAM_SERIES_SUFFIXES.findIndex(suffix => series.endsWith(suffix));
+
+const getBucketBound = ({ labels: { le } }: AggregatedSeries): number => (le === '+Inf' ? Infinity : Number(le));
+
+const getLabelSetKey = ({ labels }: AggregatedSeries): string =>
+    seriesKey('', Object.fromEntries(Object.entries(labels).filter(([key]) => key !== 'le')));
+
+// HINT: Prometheus expects histogram buckets of every label set in `le` order, followed by `_sum` and `_count`
+const compareHistogramSeries = (a: AggregatedSeries, b: AggregatedSeries): number =>
+    getLabelSetKey(a).localeCompare(getLabelSetKey(b)) ||
+    getSuffixIndex(a) - getSuffixIndex(b) ||
+    getBucketBound(a) - getBucketBound(b);
+
+const renderSeries = ({ labels, series, workers }: AggregatedSeries, aggregator: SeriesAggregator): string => {
+    const renderedLabels = Object.entries(labels)
+        .map(([key, labelValue]) => `${key}="${escapeLabel(labelValue)}"`)
+        .join(',');
+    const value = aggregators[aggregator]([...workers.values()]);
+
+    return `${series}${renderedLabels.length > 0 ? `{${renderedLabels}}` : ''} ${value}`;
+};
+
+const renderMetric = (name: string, { aggregator, help, series, type }: AggregatedMetric): string => {
+    const sortedSeries = type === 'histogram' ? [...series.values()].sort(compareHistogramSeries) : [...series.values()];
+
+    return [
+        `# HELP ${name} ${escapeHelp(help)}`,
+        `# TYPE ${name} ${type}`,
+        ...sortedSeries.map(aggregatedSeries => renderSeries(aggregatedSeries, aggregator)),
+        '',
+    ].join('\n');
+};
+
+/**
+ * Cluster primary side of the metrics aggregation: merges metrics batches pushed by workers and serves them
+ * in prometheus text format.
+ *
+ * Scrape does not talk to workers, rendered metrics are cached until the next batch arrives, so scrape cost
+ * does not depend on the number of workers. Worker values are merged with prom-client metric `aggregator`, like
+ * prom-client `AggregatorRegistry` does, gauge values of exited workers are removed.
+ */
+export class ClusterMetricsAggregator {
+    private readonly logger = new Logger(ClusterMetricsAggregator.name);
+    private readonly metrics = new Map<string, AggregatedMetric>();
+    private rendered: string | null = null;
+    private server?: Server;
+
+    /**
+     * Listen for metrics batches of cluster workers.
+     */
+    attach(cluster: Cluster): void {
+        cluster.on('message', (worker: Worker, message: unknown) => {
+            if (isClusterMetricsMessage(message)) {
+                // HINT: Malformed batch is dropped, so one worker cannot crash the primary process
+                try {
+                    this.apply(worker.id, decodeMetricsBatch(Buffer.from(message.batch, 'base64')));
+                } catch (e) {
+                    this.logger.warn(`Error applying metrics batch of worker ${worker.id}: ${getErrorMessage(e)}`);
+                }
+            }
+        });
+        cluster.on('exit', (worker: Worker) => void this.removeWorker(worker.id));
+    }
+
+    /**
+     * Serve aggregated metrics on `path` of HTTP server.
+     */
+    listen(port: number, path = '/metrics'): Promise<Server> {
+        const server = createServer((request, response) => {
+            if (request.url === path) {
+                response.writeHead(HTTP_OK, { 'Content-Type': CONTENT_TYPE }).end(this.render());
+            } else {
+                response.writeHead(HTTP_NOT_FOUND).end();
+            }
+        });
+        this.server = server;
+
+        return new Promise(resolve => void server.listen(port, () => void resolve(server)));
+    }
+
+    close(): Promise<void> {
+        return new Promise(resolve => {
+            if (this.server) {
+                this.server.close(() => void resolve());
+            } else {
+                resolve();
+            }
+        });
+    }
+
+    apply(workerId: number, batch: MetricsBatch): void {
+        batch.forEach(({ aggregator, help, name, type, values }) => {
+            if (aggregator === 'omit') {
+                return;
+            }
+
+            const metric = this.metrics.get(name) ?? { aggregator, help, series: new Map<string, AggregatedSeries>(), type };
+            this.metrics.set(name, metric);
+
+            values.forEach(({ delta, labels, series }) => {
+                const key = seriesKey(series, labels);
+                const aggregated = metric.series.get(key) ?? { labels, series, workers: new Map<number, number>() };
+                aggregated.workers.set(workerId, (aggregated.workers.get(workerId) ?? 0) + delta);
+                metric.series.set(key, aggregated);
+            });
+        });
+        this.rendered = null;
+    }
+
+    removeWorker(workerId: number): void {
+        // HINT: Counters, histograms and summaries of exited workers are kept, so they never decrease
+        this.metrics.forEach(({ series, type }) => {
+            if (type === 'gauge') {
+                series.forEach((aggregated, key) => {
+                    aggregated.workers.delete(workerId);
+
+                    if (aggregated.workers.size === 0) {
+                        series.delete(key);
+                    }
+                });
+            }
+        });
+        this.rendered = null;
+    }
+
+    /**
+     * Aggregated metrics in prometheus text format.
+     */
+    render(): string {
+        this.rendered ??= [...this.metrics.entries()].map(([name, metric]) => renderMetric(name, metric)).join('\n');
+
+        return this.rendered;
+    }
+}
@@ -0,0 +1,127 @@
+import { afterEach, describe, expect, it, jest } from '@jest/globals';
+import { Counter, Gauge, Histogram, Registry, Summary } from 'prom-client';
+
+import { ClusterMetricsReporter } from './cluster-metrics-reporter';
+import { decodeMetricsBatch } from './metrics-batch.codec';
+
+import type { ClusterMetricsMessage } from './cluster-metrics.message';
+
+const pushIntervalMs = 1000;
+
+const getRegistry = (): { counter: Counter; gauge: Gauge; histogram: Histogram; registry: Registry; summary: Summary } => {
+    const registry = new Registry();
+    const registers = [registry];
+
+    return {
+        counter: new Counter({ help: 'Counter', labelNames: ['route'], name: 'test_counter', registers }),
+        gauge: new Gauge({ help: 'Gauge', name: 'test_gauge', registers }),
+        histogram: new Histogram({ buckets: [1], help: 'Histogram', name: 'test_histogram', registers }),
+        registry,
+        summary: new Summary({ help: 'Summary', name: 'test_summary', percentiles: [0.5], registers }),
+    };
+};
+
+const getBatch = (send: jest.Mock<(message: ClusterMetricsMessage) => void>): ReturnType<typeof decodeMetricsBatch> =>
+    decodeMetricsBatch(Buffer.from(send.mock.calls[send.mock.calls.length - 1][0].batch, 'base64'));
+
+describe('ClusterMetricsReporter', () => {
+    // eslint-disable-next-line jest/no-hooks
+    afterEach(() => {
+        jest.useRealTimers();
+    });
+
+    it('should send all series on first push and changed series only later, without summary quantiles', async () => {
+        expect.assertions(4);
+
+        const { counter, histogram, registry, summary } = getRegistry();
+        const send = jest.fn<(message: ClusterMetricsMessage) => void>();
+        const reporter = new ClusterMetricsReporter(pushIntervalMs, registry, send, true);
+
+        counter.inc({ route: '/cats' }, 2);
+        histogram.observe(2);
+        summary.observe(1);
+
+        await expect(reporter.push()).resolves.toBe(8);
+        expect(
+            getBatch(send).map(({ name, values }) => [name, values.map(({ delta, series }) => [series, delta])])
+        ).toStrictEqual([
+            ['test_counter', [['test_counter', 2]]],
+            ['test_gauge', [['test_gauge', 0]]],
+            [
+                'test_histogram',
+                [
+                    ['test_histogram_bucket', 0],
+                    ['test_histogram_bucket', 1],
+                    ['test_histogram_sum', 2],
+                    ['test_histogram_count', 1],
+                ],
+            ],
+            [
+                'test_summary',
+                [
+                    ['test_summary_sum', 1],
+                    ['test_summary_count', 1],
+                ],
+            ],
+        ]);
+
+        counter.inc({ route: '/cats' });
+
+        await expect(reporter.push()).resolves.toBe(1);
+        expect(getBatch(send)[0].values[0]).toStrictEqual({ delta: 1, labels: { route: '/cats' }, series: 'test_counter' });
+    });
+
+    it('should not send empty batches and metrics with omit aggregator', async () => {
+        expect.assertions(3);
+
+        const { registry } = getRegistry();
+        const omitted = new Counter({ aggregator: 'omit', help: 'Omitted', name: 'test_omitted', registers: [registry] });
+        const send = jest.fn<(message: ClusterMetricsMessage) => void>();
+        const reporter = new ClusterMetricsReporter(pushIntervalMs, registry, send, true);
+        omitted.inc();
+
+        await reporter.push();
+
+        expect(getBatch(send).map(({ name }) => name)).not.toContain('test_omitted');
+        expect(getBatch(send)[0].aggregator).toBe('sum');
+        await expect(reporter.push()).resolves.toBe(0);
+    });
+
+    it('should push on interval and on module destroy', async () => {
+        expect.assertions(2);
+
+        jest.useFakeTimers();
+        const { gauge, registry } = getRegistry();
+        const send = jest.fn<(message: ClusterMetricsMessage) => void>();
+        const reporter = new ClusterMetricsReporter(pushIntervalMs, registry, send, true);
+        reporter.onModuleInit();
+
+        gauge.set(1);
+        await jest.advanceTimersByTimeAsync(pushIntervalMs);
+
+        expect(send).toHaveBeenCalledTimes(1);
+
+        gauge.set(0);
+        await reporter.onModuleDestroy();
+
+        expect(getBatch(send)[0].values[0]).toStrictEqual({ delta: -1, labels: {}, series: 'test_gauge' });
+    });
+
+    it('should not report outside of cluster worker', async () => {
+        expect.assertions(3);
+
+        const { counter, registry } = getRegistry();
+        const send = jest.fn<(message: ClusterMetricsMessage) => void>();
+        const withoutIpc = new ClusterMetricsReporter(pushIntervalMs, registry, undefined, true);
+        // HINT: Jest process is not a cluster worker, like a process forked with IPC channel without cluster
+        const forked = new ClusterMetricsReporter(pushIntervalMs, registry, send);
+        withoutIpc.onModuleInit();
+        forked.onModuleInit();
+        counter.inc({ route: '/cats' });
+
+        await expect(withoutIpc.push()).resolves.toBe(0);
+        await expect(forked.push()).resolves.toBe(0);
+        expect(send).not.toHaveBeenCalled();
+    });
+
+});
@@ -0,0 +1,100 @@
+import cluster from 'cluster';
+
+import { register } from 'prom-client';
+
+import { isDefined } from '@rnw-community/shared';
+
+import { seriesKey } from '../util/series-key.util';
+
+import { CLUSTER_METRICS_MESSAGE_TYPE, type ClusterMetricsMessage } from './cluster-metrics.message';
+import { encodeMetricsBatch } from './metrics-batch.codec';
+
+import type { MetricsBatch, MetricsBatchAggregator, MetricsBatchMetricType } from '../type/metrics-batch.type';
+import type { OnModuleDestroy, OnModuleInit } from '@nestjs/common';
+import type { Registry } from 'prom-client';
+
+/**
+ * Cluster worker side of the metrics aggregation: every `pushIntervalMs` collects the registry, and sends
+ * changes of series values since the previous push to the primary process over IPC in one binary batch.
+ *
+ * Summary quantiles cannot be merged between workers, so only `_sum` and `_count` series of summaries are sent.
+ * Metrics with `omit` aggregator are not sent, new series are sent even with zero value, e.g. empty histogram buckets.
+ */
+export class ClusterMetricsReporter implements OnModuleInit, OnModuleDestroy {
+    private readonly lastValues = new Map<string, number>();
+    private interval?: ReturnType<typeof setInterval>;
+
+    // eslint-disable-next-line @typescript-eslint/max-params
+    constructor(
+        private readonly pushIntervalMs: number,
+        private readonly registry: Registry = register,
+        private readonly send: ((message: ClusterMetricsMessage) => void) | undefined = process.send?.bind(process),
+        private readonly isWorker = cluster.isWorker
+    ) {}
+
+    onModuleInit(): void {
+        // HINT: Reporting makes sense only in a cluster worker, process forked without cluster also has IPC channel
+        if (this.isWorker && isDefined(this.send)) {
+            this.interval = setInterval(() => void this.push(), this.pushIntervalMs);
+            this.interval.unref();
+        }
+    }
+
+    async onModuleDestroy(): Promise<void> {
+        clearInterval(this.interval);
+        await this.push();
+    }
+
+    /**
+     * Send changed series values to the primary process.
+     *
+     * @returns Number of sent series
+     */
+    async push(): Promise<number> {
+        if (!this.isWorker || !isDefined(this.send)) {
+            return 0;
+        }
+
+        const batch = await this.collect();
+        const seriesCount = batch.reduce((sum, { values }) => sum + values.length, 0);
+
+        if (seriesCount > 0) {
+            this.send({ type: CLUSTER_METRICS_MESSAGE_TYPE, batch: encodeMetricsBatch(batch).toString('base64') });
+        }
+
+        return seriesCount;
+    }
+
+    private async collect(): Promise<MetricsBatch> {
+        const metrics = await this.registry.getMetricsAsJSON();
+
+        return metrics
+            .filter(({ aggregator }) => aggregator !== 'omit')
+            .map(({ aggregator, help, name, type, values }) => ({
+                aggregator: aggregator as MetricsBatchAggregator,
+                help,
+                name,
+                type: type as MetricsBatchMetricType,
+                values: values
+                    .filter(({ labels }) => type !== 'summary' || !isDefined(labels['quantile']))
+                    .flatMap(({ labels, value, ...rest }) => {
+                        // HINT: Histogram and summary values have own series names
+                        const series = (rest as { metricName?: string }).metricName ?? name;
+                        const stringLabels = Object.fromEntries(
+                            Object.entries(labels).map(([key, labelValue]) => [key, String(labelValue)])
+                        );
+                        const key = seriesKey(series, stringLabels);
+                        const lastValue = this.lastValues.get(key);
+                        this.lastValues.set(key, value);
+
+                        // HINT: New series are sent even with zero value, e.g. empty histogram buckets on the first push
+                        if (lastValue === value) {
+                            return [];
+                        }
+
+                        return [{ delta: value - (lastValue ?? 0), labels: stringLabels, series }];
+                    }),
+            }))
+            .filter(({ values }) => values.length > 0);
+    }
+}
@@ -0,0 +1,13 @@
+export const CLUSTER_METRICS_MESSAGE_TYPE = 'nestjs-rxjs-metrics:batch';
+
+export interface ClusterMetricsMessage {
+    // Base64 encoded binary metrics batch
+    batch: string;
+    type: typeof CLUSTER_METRICS_MESSAGE_TYPE;
+}
+
+export const isClusterMetricsMessage = (message: unknown): message is ClusterMetricsMessage =>
+    typeof message === 'object' &&
+    message !== null &&
+    (message as Partial<ClusterMetricsMessage>).type === CLUSTER_METRICS_MESSAGE_TYPE &&
+    typeof (message as Partial<ClusterMetricsMessage>).batch === 'string';
@@ -0,0 +1,67 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { decodeMetricsBatch, encodeMetricsBatch } from './metrics-batch.codec';
+
+import type { MetricsBatch } from '../type/metrics-batch.type';
+
+const batch: MetricsBatch = [
+    {
+        aggregator: 'sum',
+        help: 'Requests',
+        name: 'requests_total',
+        type: 'counter',
+        values: [
+            { delta: 1, labels: { route: '/cats', status: 'success' }, series: 'requests_total' },
+            { delta: 0.5, labels: { route: '/кошки', status: 'error' }, series: 'requests_total' },
+        ],
+    },
+    {
+        aggregator: 'max',
+        help: 'Duration',
+        name: 'duration_seconds',
+        type: 'histogram',
+        values: [
+            { delta: 2, labels: { le: '0.1' }, series: 'duration_seconds_bucket' },
+            { delta: -1.25, labels: {}, series: 'duration_seconds_sum' },
+        ],
+    },
+];
+
+describe('metrics batch codec', () => {
+    it('should decode encoded batch', () => {
+        expect.assertions(1);
+
+        expect(decodeMetricsBatch(encodeMetricsBatch(batch))).toStrictEqual(batch);
+    });
+
+    it('should write repeated strings once', () => {
+        expect.assertions(1);
+
+        const repeated: MetricsBatch = Array.from({ length: 100 }, () => batch[0]);
+
+        expect(encodeMetricsBatch(repeated).length).toBeLessThan(JSON.stringify(repeated).length / 5);
+    });
+
+    it('should grow buffer for large batches', () => {
+        expect.assertions(1);
+
+        const large: MetricsBatch = [
+            {
+                ...batch[0],
+                values: Array.from({ length: 1000 }, (_, idx) => ({
+                    delta: idx,
+                    labels: { route: `/route/${idx}` },
+                    series: 'requests_total',
+                })),
+            },
+        ];
+
+        expect(decodeMetricsBatch(encodeMetricsBatch(large))).toStrictEqual(large);
+    });
+
+    it('should throw on unsupported format version', () => {
+        expect.assertions(1);
+
+        expect(() => decodeMetricsBatch(Buffer.from([0]))).toThrow('Unsupported metrics batch format version 0');
+    });
+});
@@ -0,0 +1,170 @@
+// eslint-disable-next-line max-classes-per-file
+import type { MetricsBatch, MetricsBatchAggregator, MetricsBatchMetricType } from '../type/metrics-batch.type';
+
+const FORMAT_VERSION = 2;
+const INITIAL_BUFFER_SIZE = 1024;
+const UINT8_SIZE = 1;
+const UINT16_SIZE = 2;
+const UINT32_SIZE = 4;
+const DOUBLE_SIZE = 8;
+
+const metricTypes: MetricsBatchMetricType[] = ['counter', 'gauge', 'histogram', 'summary'];
+const metricAggregators: MetricsBatchAggregator[] = ['sum', 'first', 'min', 'max', 'average', 'omit'];
+
+class BufferWriter {
+    private buffer = Buffer.alloc(INITIAL_BUFFER_SIZE);
+    private offset = 0;
+
+    uint8(value: number): void {
+        this.offset = this.reserve(UINT8_SIZE).writeUInt8(value, this.offset);
+    }
+
+    uint16(value: number): void {
+        this.offset = this.reserve(UINT16_SIZE).writeUInt16LE(value, this.offset);
+    }
+
+    uint32(value: number): void {
+        this.offset = this.reserve(UINT32_SIZE).writeUInt32LE(value, this.offset);
+    }
+
+    double(value: number): void {
+        this.offset = this.reserve(DOUBLE_SIZE).writeDoubleLE(value, this.offset);
+    }
+
+    string(value: string): void {
+        const length = Buffer.byteLength(value);
+        this.uint16(length);
+        this.offset += this.reserve(length).write(value, this.offset);
+    }
+
+    toBuffer(): Buffer {
+        return this.buffer.subarray(0, this.offset);
+    }
+
+    private reserve(size: number): Buffer {
+        if (this.offset + size > this.buffer.length) {
+            const buffer = Buffer.alloc(Math.max(this.buffer.length * 2, this.offset + size));
+            this.buffer.copy(buffer);
+            this.buffer = buffer;
+        }
+
+        return this.buffer;
+    }
+}
+
+class BufferReader {
+    private offset = 0;
+
+    constructor(private readonly buffer: Buffer) {}
+
+    uint8(): number {
+        return this.read(UINT8_SIZE, this.buffer.readUInt8(this.offset));
+    }
+
+    uint16(): number {
+        return this.read(UINT16_SIZE, this.buffer.readUInt16LE(this.offset));
+    }
+
+    uint32(): number {
+        return this.read(UINT32_SIZE, this.buffer.readUInt32LE(this.offset));
+    }
+
+    double(): number {
+        return this.read(DOUBLE_SIZE, this.buffer.readDoubleLE(this.offset));
+    }
+
+    string(): string {
+        const length = this.uint16();
+
+        return this.read(length, this.buffer.toString('utf8', this.offset, this.offset + length));
+    }
+
+    private read<T>(size: number, value: T): T {
+        this.offset += size;
+
+        return value;
+    }
+}
+
+const collectStrings = (batch: MetricsBatch): Map<string, number> => {
+    const strings = new Map<string, number>();
+    const add = (value: string): void => {
+        if (!strings.has(value)) {
+            strings.set(value, strings.size);
+        }
+    };
+
+    batch.forEach(({ help, name, values }) => {
+        add(name);
+        add(help);
+        values.forEach(({ labels, series }) => {
+            add(series);
+            Object.entries(labels).forEach(([key, value]) => {
+                add(key);
+                add(value);
+            });
+        });
+    });
+
+    return strings;
+};
+
+/**
+ * Encode metrics batch in compact binary format: every string is written once in the string table,
+ * metrics and series refer to it by index, values are written as doubles.
+ */
+export const encodeMetricsBatch = (batch: MetricsBatch): Buffer => {
+    const strings = collectStrings(batch);
+    const writer = new BufferWriter();
+    const index = (value: string): number => strings.get(value) ?? 0;
+
+    writer.uint8(FORMAT_VERSION);
+    writer.uint32(strings.size);
+    strings.forEach((_idx, value) => void writer.string(value));
+
+    writer.uint32(batch.length);
+    batch.forEach(({ aggregator, help, name, type, values }) => {
+        writer.uint32(index(name));
+        writer.uint32(index(help));
+        writer.uint8(metricTypes.indexOf(type));
+        writer.uint8(metricAggregators.indexOf(aggregator));
+        writer.uint32(values.length);
+        values.forEach(({ delta, labels, series }) => {
+            const entries = Object.entries(labels);
+
+            writer.uint32(index(series));
+            writer.uint8(entries.length);
+            entries.forEach(([key, value]) => {
+                writer.uint32(index(key));
+                writer.uint32(index(value));
+            });
+            writer.double(delta);
+        });
+    });
+
+    return writer.toBuffer();
+};
+
+export const decodeMetricsBatch = (buffer: Buffer): MetricsBatch => {
+    const reader = new BufferReader(buffer);
+    const version = reader.uint8();
+
+    if (version !== FORMAT_VERSION) {
+        throw new Error(`Unsupported metrics batch format version ${version}`);
+    }
+
+    const strings = Array.from({ length: reader.uint32() }, () => reader.string());
+    const string = (): string => strings[reader.uint32()];
+
+    return Array.from({ length: reader.uint32() }, () => ({
+        name: string(),
+        help: string(),
+        type: metricTypes[reader.uint8()],
+        aggregator: metricAggregators[reader.uint8()],
+        values: Array.from({ length: reader.uint32() }, () => ({
+            series: string(),
+            labels: Object.fromEntries(Array.from({ length: reader.uint8() }, () => [string(), string()])),
+            delta: reader.double(),
+        })),
+    }));
+};
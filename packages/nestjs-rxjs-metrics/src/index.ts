@@ -1,2 +1,9 @@
 export * from './nestjs-rxjs-metrics.module';
 export * from './nestjs-rxjs-metrics-service/nestjs-rxjs-metrics.service';
+
+export type { MetricsBindOptionsInterface } from './interface/metrics-bind-options.interface';
+export type { BoundOperator } from './type/bound-operator.type';
+
+export * from './cluster/cluster-metrics-aggregator';
+export * from './cluster/cluster-metrics-reporter';
+export type { MetricsBatch, MetricsBatchAggregator, MetricsBatchMetric, MetricsBatchValue } from './type/metrics-batch.type';
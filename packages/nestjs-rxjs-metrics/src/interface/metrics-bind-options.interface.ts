@@ -0,0 +1,4 @@
+export interface MetricsBindOptionsInterface {
+    // Sum values locally and flush them to prom-client every `flushIntervalMs` milliseconds, disabled if not positive
+    flushIntervalMs?: number;
+}
@@ -9,8 +9,14 @@ export interface MetricsModuleOptionsInterface<
     S extends MetricConfig,
     HL extends LabelsConfig<H> = LabelsConfig<H>,
     SL extends LabelsConfig<S> = LabelsConfig<S>,
+    CL extends LabelsConfig<C> = LabelsConfig<C>,
+    GL extends LabelsConfig<G> = LabelsConfig<G>,
 > extends PrometheusOptions {
+    // Push worker metrics to the cluster primary, see `ClusterMetricsAggregator`
+    clusterAggregation?: { pushIntervalMs: number };
+    counterLabels?: CL;
     counterMetrics: C;
+    gaugeLabels?: GL;
     gaugeMetrics: G;
     histogramLabels?: HL;
     histogramMetrics: H;
@@ -0,0 +1,47 @@
+import { afterEach, describe, expect, it, jest } from '@jest/globals';
+
+import { MetricAccumulator } from './metric-accumulator';
+
+const flushIntervalMs = 1000;
+
+describe('MetricAccumulator', () => {
+    // eslint-disable-next-line jest/no-hooks
+    afterEach(() => {
+        jest.useRealTimers();
+    });
+
+    it('should apply accumulated sum once per flush interval', async () => {
+        expect.assertions(3);
+
+        jest.useFakeTimers();
+        const apply = jest.fn<(value: number) => void>();
+        const accumulator = new MetricAccumulator(apply, flushIntervalMs);
+
+        accumulator.add(1);
+        accumulator.add(2);
+
+        expect(apply).not.toHaveBeenCalled();
+
+        await jest.advanceTimersByTimeAsync(flushIntervalMs);
+
+        expect(apply).toHaveBeenCalledWith(3);
+
+        await jest.advanceTimersByTimeAsync(flushIntervalMs);
+
+        expect(apply).toHaveBeenCalledTimes(1);
+
+        accumulator.close();
+    });
+
+    it('should flush pending value on close', () => {
+        expect.assertions(1);
+
+        const apply = jest.fn<(value: number) => void>();
+        const accumulator = new MetricAccumulator(apply, flushIntervalMs);
+
+        accumulator.add(-1);
+        accumulator.close();
+
+        expect(apply).toHaveBeenCalledWith(-1);
+    });
+});
@@ -0,0 +1,34 @@
+/**
+ * Sums metric values in this process and applies the sum to prom-client once per flush interval,
+ * so hot streams pay for a number addition instead of a prom-client call per event.
+ */
+export class MetricAccumulator {
+    private pending = 0;
+    private readonly interval: ReturnType<typeof setInterval>;
+
+    constructor(
+        private readonly apply: (value: number) => void,
+        flushIntervalMs: number
+    ) {
+        this.interval = setInterval(() => void this.flush(), flushIntervalMs);
+        // HINT: Flush timer should not keep the process alive
+        this.interval.unref();
+    }
+
+    add(value: number): void {
+        this.pending += value;
+    }
+
+    flush(): void {
+        if (this.pending !== 0) {
+            const value = this.pending;
+            this.pending = 0;
+            this.apply(value);
+        }
+    }
+
+    close(): void {
+        clearInterval(this.interval);
+        this.flush();
+    }
+}
@@ -1,6 +1,8 @@
 import { describe, expect, it, jest } from '@jest/globals';
 import { Logger } from '@nestjs/common';
-import { of } from 'rxjs';
+import { Subject, from, of, throwError } from 'rxjs';
+
+import { emptyFn } from '@rnw-community/shared';
 
 import { createMetricsRecord } from '../util/create-metrics-record.util';
 
@@ -46,7 +48,12 @@ class MetricsService extends NestJSRxJSMetricsService<
 }
 
 jest.mock('@willsoto/nestjs-prometheus', () => ({
-    getOrCreateMetric: () => ({ inc: jest.fn(), dec: jest.fn(), startTimer: jest.fn() }),
+    getOrCreateMetric: () => ({
+        inc: jest.fn(),
+        dec: jest.fn(),
+        startTimer: jest.fn(),
+        labels: jest.fn(() => ({ inc: jest.fn(), startTimer: jest.fn() })),
+    }),
 }));
 jest.mock('@nestjs/common', () => ({ Logger: { error: jest.fn() } }));
 
@@ -257,4 +264,146 @@ describe('NestJSRxJSMetricsService', () => {
                 done();
             });
     });
+
+    it('histogram$ operator should time every subscription separately', () => {
+        expect.assertions(4);
+
+        const service = new MetricsService();
+        const firstEndTimerFn = jest.fn<() => number>();
+        const secondEndTimerFn = jest.fn<() => number>();
+        const histogramSpy = jest
+            .spyOn(histogramRecord.my_histogram_metric, 'startTimer')
+            .mockReturnValueOnce(firstEndTimerFn)
+            .mockReturnValueOnce(secondEndTimerFn);
+        const first$ = new Subject<boolean>();
+        const second$ = new Subject<boolean>();
+
+        first$.pipe(service.histogram$('my_histogram_metric', { my_histogram_metric_label: 1 })).subscribe();
+        second$.pipe(service.histogram$('my_histogram_metric')).subscribe();
+        second$.complete();
+
+        expect(histogramSpy).toHaveBeenCalledWith({ my_histogram_metric_label: 1 });
+        expect(firstEndTimerFn).not.toHaveBeenCalled();
+        expect(secondEndTimerFn).toHaveBeenCalledTimes(1);
+
+        first$.error(new Error('Failed'));
+
+        expect(firstEndTimerFn).toHaveBeenCalledTimes(1);
+    });
+
+    it('histogram$ operator should not observe unsubscribed stream', () => {
+        expect.assertions(1);
+
+        const service = new MetricsService();
+        const histogramEndTimerFn = jest.fn<() => number>();
+        jest.spyOn(histogramRecord.my_histogram_metric, 'startTimer').mockReturnValueOnce(histogramEndTimerFn);
+
+        new Subject<boolean>().pipe(service.histogram$('my_histogram_metric')).subscribe().unsubscribe();
+
+        expect(histogramEndTimerFn).not.toHaveBeenCalled();
+    });
+
+    it('summary$ operator should observe duration till error', () => {
+        expect.assertions(2);
+
+        const service = new MetricsService();
+        const summaryEndTimerFn = jest.fn<() => number>();
+        const summarySpy = jest
+            .spyOn(summaryRecord.my_summary_metric, 'startTimer')
+            .mockReturnValueOnce(summaryEndTimerFn);
+
+        throwError(() => new Error('Failed'))
+            .pipe(service.summary$('my_summary_metric', { my_summary_label: 1 }))
+            .subscribe({ error: emptyFn });
+
+        expect(summarySpy).toHaveBeenCalledWith({ my_summary_label: 1 });
+        expect(summaryEndTimerFn).toHaveBeenCalledTimes(1);
+    });
+
+    describe('bound operators', () => {
+        interface ChildMock {
+            inc: jest.Mock<(value?: number) => void>;
+            startTimer: jest.Mock<() => () => number>;
+        }
+
+        const getChild = (metric: { labels: unknown }): ChildMock => {
+            const { results } = (metric.labels as jest.Mock<() => ChildMock>).mock;
+
+            return results[results.length - 1].value as ChildMock;
+        };
+
+        it('bindCounter should resolve child metric once and increment it on every event', () => {
+            expect.assertions(4);
+
+            const service = new MetricsService();
+            const labelsSpy = jest.spyOn(counterRecord.my_counter_metric, 'labels');
+            labelsSpy.mockClear();
+
+            const counter = service.bindCounter('my_counter_metric', { route: '/cats' }, 2);
+            from([1, 2, 3]).pipe(counter).subscribe();
+
+            expect(labelsSpy).toHaveBeenCalledTimes(1);
+            expect(labelsSpy).toHaveBeenCalledWith({ route: '/cats' });
+            expect(getChild(counterRecord.my_counter_metric).inc).toHaveBeenCalledTimes(3);
+            expect(getChild(counterRecord.my_counter_metric).inc).toHaveBeenCalledWith(2);
+        });
+
+        it('bindGauge should accumulate values locally until flush', () => {
+            expect.assertions(3);
+
+            const service = new MetricsService();
+            const gauge = service.bindGauge('my_gauge_metric', {}, -1, { flushIntervalMs: 1000 });
+            const { inc } = getChild(gaugeRecord.my_gauge_metric);
+
+            from([1, 2, 3]).pipe(gauge).subscribe();
+
+            expect(inc).not.toHaveBeenCalled();
+
+            service.flush();
+
+            expect(inc).toHaveBeenCalledWith(-3);
+
+            from([1]).pipe(gauge).subscribe();
+            service.onModuleDestroy();
+
+            expect(inc).toHaveBeenLastCalledWith(-1);
+        });
+
+        it('bindCounter should share accumulator between operators bound to the same labels', () => {
+            expect.assertions(2);
+
+            const service = new MetricsService();
+            const first = service.bindCounter('my_counter_metric', { route: '/cats' }, 1, { flushIntervalMs: 1000 });
+            const { inc } = getChild(counterRecord.my_counter_metric);
+            const second = service.bindCounter('my_counter_metric', { route: '/cats' }, 2, { flushIntervalMs: 1000 });
+            const other = service.bindCounter('my_counter_metric', { route: '/dogs' }, 1, { flushIntervalMs: 1000 });
+
+            from([1, 2]).pipe(first, second, other).subscribe();
+            service.onModuleDestroy();
+
+            expect(inc).toHaveBeenCalledTimes(1);
+            expect(inc).toHaveBeenCalledWith(6);
+        });
+
+        it('bindHistogram and bindSummary should time every subscription with child metric', () => {
+            expect.assertions(4);
+
+            const service = new MetricsService();
+            const histogram = service.bindHistogram('my_histogram_metric', { my_histogram_metric_label: 1 });
+            const summary = service.bindSummary('my_summary_metric');
+            const histogramChild = getChild(histogramRecord.my_histogram_metric);
+            const summaryChild = getChild(summaryRecord.my_summary_metric);
+            const histogramEndTimerFn = jest.fn<() => number>();
+            histogramChild.startTimer.mockReturnValue(histogramEndTimerFn);
+            summaryChild.startTimer.mockReturnValue(jest.fn<() => number>());
+
+            of(true).pipe(histogram, summary).subscribe();
+            of(true).pipe(histogram).subscribe();
+
+            expect(histogramRecord.my_histogram_metric.labels).toHaveBeenLastCalledWith({ my_histogram_metric_label: 1 });
+            expect(histogramChild.startTimer).toHaveBeenCalledTimes(2);
+            expect(histogramEndTimerFn).toHaveBeenCalledTimes(2);
+            expect(summaryChild.startTimer).toHaveBeenCalledTimes(1);
+        });
+    });
 });
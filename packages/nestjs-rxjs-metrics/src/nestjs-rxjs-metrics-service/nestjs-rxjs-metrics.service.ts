@@ -1,15 +1,22 @@
 import { Logger } from '@nestjs/common';
+import { tap } from 'rxjs';
 
 import { isDefined } from '@rnw-community/shared';
 
+import { MetricAccumulator } from '../metric-accumulator/metric-accumulator';
 import { rxjsOperator } from '../util/rxjs-operator.util';
+import { seriesKey } from '../util/series-key.util';
+import { timerOperator } from '../util/timer-operator.util';
 
+import type { MetricsBindOptionsInterface } from '../interface/metrics-bind-options.interface';
+import type { BoundOperator } from '../type/bound-operator.type';
 import type { HistogramRecord } from '../type/histogram-record.type';
 import type { LabelsConfig } from '../type/labels-config.type';
 import type { MetricConfig as MC } from '../type/metrics-config.type';
 import type { SummaryRecord } from '../type/summary-record.type';
+import type { OnModuleDestroy } from '@nestjs/common';
 import type { Counter, Gauge, Histogram, LabelValues, Summary } from 'prom-client';
-import type { MonoTypeOperatorFunction } from 'rxjs';
+import type { MonoTypeOperatorFunction, Observable } from 'rxjs';
 
 type ValuesOf<T extends readonly string[]> = T[number];
 
@@ -21,9 +28,12 @@ export class NestJSRxJSMetricsService<
     S extends MC,
     HL extends LabelsConfig<H> = LabelsConfig<H>,
     SL extends LabelsConfig<S> = LabelsConfig<S>,
-> {
+    CL extends LabelsConfig<C> = LabelsConfig<C>,
+    GL extends LabelsConfig<G> = LabelsConfig<G>,
+> implements OnModuleDestroy {
     protected readonly startedHistogramMetrics: HistogramRecord<H>;
     protected readonly startedSummaryMetrics: SummaryRecord<S>;
+    protected readonly accumulators = new Map<string, MetricAccumulator>();
 
     constructor(
         protected readonly counterMetrics: Record<keyof C, Counter>,
@@ -39,6 +49,18 @@ export class NestJSRxJSMetricsService<
         ) as unknown as SummaryRecord<S>;
     }
 
+    onModuleDestroy(): void {
+        this.accumulators.forEach(accumulator => void accumulator.close());
+        this.accumulators.clear();
+    }
+
+    /**
+     * Apply values accumulated by bound operators with `flushIntervalMs` option to prom-client right away.
+     */
+    flush(): void {
+        this.accumulators.forEach(accumulator => void accumulator.flush());
+    }
+
     counter<T>(metric: keyof C, value = 1): MonoTypeOperatorFunction<T> {
         return rxjsOperator(() => {
             this.counterMetrics[metric].inc(value);
@@ -59,12 +81,87 @@ export class NestJSRxJSMetricsService<
         return this.gauge(metric, gauge => void gauge.dec(value));
     }
 
+    /**
+     * Counter operator for hot streams, prom-client child metric is resolved once instead of on every event.
+     *
+     * @param metric Counter metric
+     * @param labels Counter metric labels
+     * @param value Increment on every event
+     * @param options Local accumulation options
+     */
+    bindCounter(
+        metric: keyof C,
+        labels: LabelValues<ValuesOf<CL[keyof C]>> = {},
+        value = 1,
+        options: MetricsBindOptionsInterface = {}
+    ): BoundOperator {
+        const child = this.counterMetrics[metric].labels(labels);
+        const series = seriesKey(`counter:${metric as string}`, labels as Record<string, string>);
+
+        return this.bindEvent(series, increment => void child.inc(increment), value, options);
+    }
+
+    /**
+     * Gauge operator for hot streams, prom-client child metric is resolved once instead of on every event.
+     *
+     * @param metric Gauge metric
+     * @param labels Gauge metric labels
+     * @param value Increment on every event, negative value decrements the gauge
+     * @param options Local accumulation options
+     */
+    bindGauge(
+        metric: keyof G,
+        labels: LabelValues<ValuesOf<GL[keyof G]>> = {},
+        value = 1,
+        options: MetricsBindOptionsInterface = {}
+    ): BoundOperator {
+        const child = this.gaugeMetrics[metric].labels(labels);
+        const series = seriesKey(`gauge:${metric as string}`, labels as Record<string, string>);
+
+        return this.bindEvent(series, increment => void child.inc(increment), value, options);
+    }
+
+    /**
+     * `histogram$` operator with prom-client child metric resolved once for the labels.
+     */
+    bindHistogram(metric: keyof H, labels: LabelValues<ValuesOf<HL[keyof H]>> = {}): BoundOperator {
+        const child = this.histogramMetrics[metric].labels(labels);
+
+        return <T>(source$: Observable<T>): Observable<T> => source$.pipe(timerOperator(() => child.startTimer()));
+    }
+
+    /**
+     * `summary$` operator with prom-client child metric resolved once for the labels.
+     */
+    bindSummary(metric: keyof S, labels: LabelValues<ValuesOf<SL[keyof S]>> = {}): BoundOperator {
+        const child = this.summaryMetrics[metric].labels(labels);
+
+        return <T>(source$: Observable<T>): Observable<T> => source$.pipe(timerOperator(() => child.startTimer()));
+    }
+
+    /**
+     * Observe duration from subscription to completion or error in Histogram metric, every subscription is timed separately.
+     *
+     * @param metric Histogram metric
+     * @param labels Histogram metric labels
+     */
+    histogram$<T>(metric: keyof H, labels?: LabelValues<ValuesOf<HL[keyof H]>>): MonoTypeOperatorFunction<T> {
+        return timerOperator(() => this.histogramMetrics[metric].startTimer(labels));
+    }
+
+    /**
+     * @deprecated Timers are shared by all streams and ended in LIFO order, so concurrent streams observe
+     * durations of each other, use `histogram$` instead
+     */
     histogramStart<T>(metric: keyof H, labels?: LabelValues<ValuesOf<HL[keyof H]>>): MonoTypeOperatorFunction<T> {
         return rxjsOperator(() => {
             this.startedHistogramMetrics[metric].push(this.histogramMetrics[metric].startTimer(labels));
         });
     }
 
+    /**
+     * @deprecated Use `histogram$` instead
+     */
     histogramEnd<T>(metric: keyof H, labels?: LabelValues<ValuesOf<HL[keyof H]>>): MonoTypeOperatorFunction<T> {
         return rxjsOperator(() => {
             const metricEndFn = this.startedHistogramMetrics[metric].pop();
@@ -80,12 +177,29 @@ export class NestJSRxJSMetricsService<
         });
     }
 
+    /**
+     * Observe duration from subscription to completion or error in Summary metric, every subscription is timed separately.
+     *
+     * @param metric Summary metric
+     * @param labels Summary metric labels
+     */
+    summary$<T>(metric: keyof S, labels?: LabelValues<ValuesOf<SL[keyof S]>>): MonoTypeOperatorFunction<T> {
+        return timerOperator(() => this.summaryMetrics[metric].startTimer(labels));
+    }
+
+    /**
+     * @deprecated Timers are shared by all streams and ended in LIFO order, so concurrent streams observe
+     * durations of each other, use `summary$` instead
+     */
     summaryStart<T>(metric: keyof S, labels?: LabelValues<ValuesOf<SL[keyof S]>>): MonoTypeOperatorFunction<T> {
         return rxjsOperator(() => {
             this.startedSummaryMetrics[metric].push(this.summaryMetrics[metric].startTimer(labels));
         });
     }
 
+    /**
+     * @deprecated Use `summary$` instead
+     */
     summaryEnd<T>(metric: keyof S, labels?: LabelValues<ValuesOf<SL[keyof S]>>): MonoTypeOperatorFunction<T> {
         return rxjsOperator(() => {
             const metricEndFn = this.startedSummaryMetrics[metric].pop();
@@ -100,4 +214,23 @@ export class NestJSRxJSMetricsService<
             }
         });
     }
+
+    private bindEvent(
+        series: string,
+        apply: (value: number) => void,
+        value: number,
+        options: MetricsBindOptionsInterface
+    ): BoundOperator {
+        const { flushIntervalMs = 0 } = options;
+
+        if (flushIntervalMs <= 0) {
+            return <T>(source$: Observable<T>): Observable<T> => source$.pipe(tap(() => void apply(value)));
+        }
+
+        // HINT: Operators bound to the same metric series share one accumulator and its flush interval
+        const accumulator = this.accumulators.get(series) ?? new MetricAccumulator(apply, flushIntervalMs);
+        this.accumulators.set(series, accumulator);
+
+        return <T>(source$: Observable<T>): Observable<T> => source$.pipe(tap(() => void accumulator.add(value)));
+    }
 }
@@ -1,5 +1,6 @@
 import { describe, expect, it, jest } from '@jest/globals';
 
+import { ClusterMetricsReporter } from './cluster/cluster-metrics-reporter';
 import { NestJSRxJSMetricsModule } from './nestjs-rxjs-metrics.module';
 import { createMetricsRecord } from './util/create-metrics-record.util';
 
@@ -79,4 +80,20 @@ describe('NestJSRxJSMetricsModule', () => {
         expect(MetricsModule.providers).toContain(MetricsService);
         expect(typeof MetricsService === 'function').toBeTruthy();
     });
+
+    it('should provide cluster metrics reporter in cluster aggregation mode', () => {
+        expect.assertions(2);
+
+        const [MetricsModule] = NestJSRxJSMetricsModule.create({
+            counterMetrics,
+            gaugeMetrics,
+            histogramMetrics,
+            summaryMetrics,
+            clusterAggregation: { pushIntervalMs: 1000 },
+        });
+        const provider = MetricsModule.providers?.[1] as { provide: unknown; useFactory: () => unknown };
+
+        expect(provider.provide).toBe(ClusterMetricsReporter);
+        expect(provider.useFactory()).toBeInstanceOf(ClusterMetricsReporter);
+    });
 });
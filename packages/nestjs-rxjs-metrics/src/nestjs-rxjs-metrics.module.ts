@@ -2,6 +2,9 @@
 import { Module } from '@nestjs/common';
 import { PrometheusModule } from '@willsoto/nestjs-prometheus';
 
+import { isDefined } from '@rnw-community/shared';
+
+import { ClusterMetricsReporter } from './cluster/cluster-metrics-reporter';
 import { NestJSRxJSMetricsService } from './nestjs-rxjs-metrics-service/nestjs-rxjs-metrics.service';
 import { createMetricsRecord } from './util/create-metrics-record.util';
 
@@ -16,7 +19,7 @@ export class NestJSRxJSMetricsModule {
      * Create module and strongly typed service class for extension.
      *
      * @param options Metrics configuration object
-     * @return [DynamicModule, Type<NestJSRxJSMetricsService<C, G, H, S, SL, HL>>] Tuple with typed dynamic module and service class for extending
+     * @return [DynamicModule, Type<NestJSRxJSMetricsService<C, G, H, S, HL, SL, CL, GL>>] Tuple with typed dynamic module and service class for extending
      */
     static create<
         C extends MC,
@@ -25,11 +28,16 @@ export class NestJSRxJSMetricsModule {
         S extends MC,
         HL extends LabelsConfig<H> = LabelsConfig<H>,
         SL extends LabelsConfig<S> = LabelsConfig<S>,
+        CL extends LabelsConfig<C> = LabelsConfig<C>,
+        GL extends LabelsConfig<G> = LabelsConfig<G>,
     >(
-        options: MetricsModuleOptionsInterface<C, G, H, S, HL, SL>
-    ): [DynamicModule, Type<NestJSRxJSMetricsService<C, G, H, S, HL, SL>>] {
+        options: MetricsModuleOptionsInterface<C, G, H, S, HL, SL, CL, GL>
+    ): [DynamicModule, Type<NestJSRxJSMetricsService<C, G, H, S, HL, SL, CL, GL>>] {
         const {
+            clusterAggregation,
+            counterLabels,
             counterMetrics,
+            gaugeLabels,
             gaugeMetrics,
             histogramMetrics,
             summaryMetrics,
@@ -38,11 +46,11 @@ export class NestJSRxJSMetricsModule {
             ...nestjsPrometheusOptions
         } = options;
 
-        class MetricsService extends NestJSRxJSMetricsService<C, G, H, S, HL, SL> {
+        class MetricsService extends NestJSRxJSMetricsService<C, G, H, S, HL, SL, CL, GL> {
             constructor() {
                 super(
-                    createMetricsRecord('Counter', counterMetrics),
-                    createMetricsRecord('Gauge', gaugeMetrics),
+                    createMetricsRecord('Counter', counterMetrics, counterLabels),
+                    createMetricsRecord('Gauge', gaugeMetrics, gaugeLabels),
                     createMetricsRecord('Histogram', histogramMetrics, histogramLabels),
                     createMetricsRecord('Summary', summaryMetrics, summaryLabels)
                 );
@@ -52,7 +60,17 @@ export class NestJSRxJSMetricsModule {
         const MetricsModule = {
             imports: [PrometheusModule.register(nestjsPrometheusOptions)],
             module: NestJSRxJSMetricsModule,
-            providers: [MetricsService],
+            providers: [
+                MetricsService,
+                ...(isDefined(clusterAggregation)
+                    ? [
+                          {
+                              provide: ClusterMetricsReporter,
+                              useFactory: () => new ClusterMetricsReporter(clusterAggregation.pushIntervalMs),
+                          },
+                      ]
+                    : []),
+            ],
             exports: [MetricsService],
         };
 
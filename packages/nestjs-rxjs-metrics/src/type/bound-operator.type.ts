@@ -0,0 +1,3 @@
+import type { Observable } from 'rxjs';
+
+export type BoundOperator = <T>(source$: Observable<T>) => Observable<T>;
@@ -0,0 +1,22 @@
+export type MetricsBatchMetricType = 'counter' | 'gauge' | 'histogram' | 'summary';
+
+// HINT: prom-client metric `aggregator`, how values of cluster workers are merged
+export type MetricsBatchAggregator = 'average' | 'first' | 'max' | 'min' | 'omit' | 'sum';
+
+export interface MetricsBatchValue {
+    // Value change since the previous batch of the worker
+    delta: number;
+    labels: Record<string, string>;
+    // Series name, e.g. `_bucket`, `_sum` or `_count` series of histogram
+    series: string;
+}
+
+export interface MetricsBatchMetric {
+    aggregator: MetricsBatchAggregator;
+    help: string;
+    name: string;
+    type: MetricsBatchMetricType;
+    values: MetricsBatchValue[];
+}
+
+export type MetricsBatch = MetricsBatchMetric[];
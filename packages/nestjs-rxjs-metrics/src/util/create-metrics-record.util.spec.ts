@@ -0,0 +1,47 @@
+import { describe, expect, it } from '@jest/globals';
+import { lastValueFrom, of } from 'rxjs';
+
+import { NestJSRxJSMetricsService } from '../nestjs-rxjs-metrics-service/nestjs-rxjs-metrics.service';
+
+import { createMetricsRecord } from './create-metrics-record.util';
+
+import type { Counter, Gauge } from 'prom-client';
+
+const counterMetrics = { create_metrics_record_counter: 'Counter with labels' };
+const gaugeMetrics = { create_metrics_record_gauge: 'Gauge with labels' };
+
+const counterLabels = { create_metrics_record_counter: ['route'] as const };
+const gaugeLabels = { create_metrics_record_gauge: ['route'] as const };
+
+describe('createMetricsRecord', () => {
+    it('should create prom-client metrics with label names usable by bound operators', async () => {
+        expect.assertions(2);
+
+        const counterRecord = createMetricsRecord<Counter, typeof counterMetrics>('Counter', counterMetrics, counterLabels);
+        const gaugeRecord = createMetricsRecord<Gauge, typeof gaugeMetrics>('Gauge', gaugeMetrics, gaugeLabels);
+        const service = new NestJSRxJSMetricsService<
+            typeof counterMetrics,
+            typeof gaugeMetrics,
+            Record<string, string>,
+            Record<string, string>,
+            Record<string, readonly string[]>,
+            Record<string, readonly string[]>,
+            typeof counterLabels,
+            typeof gaugeLabels
+        >(counterRecord, gaugeRecord, {}, {});
+
+        await lastValueFrom(
+            of(1, 2).pipe(
+                service.bindCounter('create_metrics_record_counter', { route: 'orders' }),
+                service.bindGauge('create_metrics_record_gauge', { route: 'orders' }, 2)
+            )
+        );
+
+        await expect(counterRecord.create_metrics_record_counter.get()).resolves.toMatchObject({
+            values: [{ labels: { route: 'orders' }, value: 2 }],
+        });
+        await expect(gaugeRecord.create_metrics_record_gauge.get()).resolves.toMatchObject({
+            values: [{ labels: { route: 'orders' }, value: 4 }],
+        });
+    });
+});
@@ -17,7 +17,7 @@ export const createMetricsRecord = <M, T extends MetricConfig>(
             [metric]: getOrCreateMetric(type, {
                 name: metric,
                 help: enumObj[metric],
-                ...(isDefined(labelNames) && { labelNames: Object.keys(labelNames[metric]) }),
+                ...(isDefined(labelNames) && { labelNames: [...labelNames[metric]] }),
             }),
         }),
         // eslint-disable-next-line @typescript-eslint/consistent-type-assertions,@typescript-eslint/prefer-reduce-type-parameter
@@ -0,0 +1,5 @@
+/**
+ * Unique key of metric series, independent of labels order.
+ */
+export const seriesKey = (series: string, labels: Record<string, string>): string =>
+    `${series}${JSON.stringify(Object.entries(labels).sort(([a], [b]) => a.localeCompare(b)))}`;
@@ -0,0 +1,16 @@
+import { defer, tap } from 'rxjs';
+
+import type { MonoTypeOperatorFunction, Observable } from 'rxjs';
+
+/**
+ * Start a timer on each subscription and stop it when this subscription completes or errors,
+ * unsubscribed(cancelled) subscriptions are not observed.
+ */
+export const timerOperator =
+    <T>(startTimer: () => () => unknown): MonoTypeOperatorFunction<T> =>
+    (source$: Observable<T>): Observable<T> =>
+        defer(() => {
+            const endTimer = startTimer();
+
+            return source$.pipe(tap({ complete: () => void endTimer(), error: () => void endTimer() }));
+        });
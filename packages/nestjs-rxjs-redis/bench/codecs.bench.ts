@@ -0,0 +1,57 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { measureOpsPerSec } from '../../../bench/benchmark';
+import { createCompressedCodec } from '../src/codec/compressed.codec';
+import { createJsonCodec } from '../src/codec/json.codec';
+import { createV8Codec } from '../src/codec/v8.codec';
+import { RedisCompressionEnum } from '../src/enum/redis-compression.enum';
+
+import type { RedisCodecInterface } from '../src/interface/redis-codec.interface';
+
+const createProduct = (id: number): Record<string, unknown> => ({
+    id,
+    sku: `SKU-${id}`,
+    name: `Product ${id}`,
+    description: 'Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt',
+    price: { amount: id * 100, currency: 'USD' },
+    tags: ['catalog', 'featured', `category-${id % 10}`],
+    available: id % 2 === 0,
+});
+
+const payloads = {
+    // ~1KB, typical entity
+    small: { products: Array.from({ length: 4 }, (_, id) => createProduct(id)) },
+    // ~100KB, catalog blob
+    large: { products: Array.from({ length: 400 }, (_, id) => createProduct(id)) },
+};
+
+const codecs: Record<string, RedisCodecInterface<unknown>> = {
+    // HINT: Same cost as save/load/cache string values
+    json: createJsonCodec(),
+    v8: createV8Codec(),
+    'json + gzip': createCompressedCodec(createJsonCodec(), RedisCompressionEnum.Gzip),
+    'json + brotli': createCompressedCodec(createJsonCodec(), RedisCompressionEnum.Brotli),
+    'v8 + brotli': createCompressedCodec(createV8Codec(), RedisCompressionEnum.Brotli),
+};
+
+describe('NestJSRxJSRedis codecs', () => {
+    it.each(Object.keys(payloads) as Array<keyof typeof payloads>)('%s payload', payloadName => {
+        const payload = payloads[payloadName];
+
+        const results = Object.entries(codecs).map(([codecName, codec]) => {
+            const encoded = codec.encode(payload);
+
+            expect(codec.decode(encoded)).toStrictEqual(payload);
+
+            return {
+                codec: codecName,
+                bytes: encoded.length,
+                'encode ops/sec': measureOpsPerSec(() => codec.encode(payload)),
+                'decode ops/sec': measureOpsPerSec(() => codec.decode(encoded)),
+            };
+        });
+
+        // eslint-disable-next-line no-console
+        console.table(results);
+    });
+});
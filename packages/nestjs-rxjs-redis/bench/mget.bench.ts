@@ -0,0 +1,31 @@
+import { describe, expect, it, jest } from '@jest/globals';
+import { lastValueFrom } from 'rxjs';
+
+import { measureOpsPerSec } from '../../../bench/benchmark';
+import { NestJSRxJSRedisService } from '../src/nestjs-rxjs-redis-service/nestjs-rxjs-redis.service';
+import { zipKeysValues } from '../src/util/zip-keys-values.util';
+
+import type { Redis } from 'ioredis';
+
+// HINT: Previous mget$ implementation, copies accumulator on every key
+const reduceSpread = (keys: string[], values: Array<string | null>): Record<string, string | null> =>
+    values.reduce<Record<string, string | null>>((prev, cur, idx) => ({ ...prev, [keys[idx]]: cur }), {});
+
+const keyCounts = [10, 1000, 10000];
+
+describe('NestJSRxJSRedis mget$', () => {
+    it.each(keyCounts)('%s keys', async keyCount => {
+        const keys = Array.from({ length: keyCount }, (_, idx) => `key-${idx}`);
+        const values = keys.map(key => `${key}-value`);
+        const mget = jest.fn(() => Promise.resolve(values));
+        const redis = new NestJSRxJSRedisService({ mget } as unknown as Redis);
+
+        expect(await lastValueFrom(redis.mget$(keys))).toStrictEqual(reduceSpread(keys, values));
+
+        // eslint-disable-next-line no-console
+        console.table([
+            { implementation: 'reduce spread', 'ops/sec': measureOpsPerSec(() => reduceSpread(keys, values)) },
+            { implementation: 'zipKeysValues', 'ops/sec': measureOpsPerSec(() => zipKeysValues(keys, values)) },
+        ]);
+    });
+});
@@ -0,0 +1,79 @@
+import { describe, expect, it } from '@jest/globals';
+import { Redis } from 'ioredis';
+import { defer, lastValueFrom, map, take, toArray } from 'rxjs';
+
+import { benchRedisUrl, elapsedMs, roundTrip } from '../../../bench/benchmark';
+import { RedisStreamConsumer } from '../src/redis-stream-consumer/redis-stream-consumer';
+
+import type { RedisStreamEntryInterface } from '../src/interface/redis-stream-entry.interface';
+import type { Observable } from 'rxjs';
+
+const MS_IN_SEC = 1000;
+const ENTRIES = 10000;
+
+const counts = [1, 10, 100];
+const concurrencies = [1, 10, 100];
+
+const createMemoryClient = (): Redis => {
+    let lastId = 0;
+    const client = {
+        disconnect: () => void 0,
+        xgroup: () => Promise.resolve('OK'),
+        pipeline: (commands: Array<Array<number | string>>) => ({
+            exec: () => {
+                const readCount = Number(commands[commands.length - 1][5]);
+                const entries = Array.from({ length: readCount }, () => [`${++lastId}-0`, ['value', `${lastId}`]]);
+
+                const ackReplies = commands.slice(1).map(() => [null, 1]);
+
+                return roundTrip([...ackReplies, [null, [['stream', entries]]]]);
+            },
+        }),
+    };
+
+    return { duplicate: () => client } as unknown as Redis;
+};
+
+const createRedisClient = async (url: string, stream: string): Promise<Redis> => {
+    const redis = new Redis(url);
+    const pipeline = redis.pipeline();
+    for (let id = 0; id < ENTRIES; id++) {
+        pipeline.xadd(stream, '*', 'value', `${id}`);
+    }
+    await redis.xgroup('CREATE', stream, 'bench', '0', 'MKSTREAM');
+    await pipeline.exec();
+
+    return redis;
+};
+
+// HINT: Simulates asynchronous handler, like a database write
+const handler$ = (entry: RedisStreamEntryInterface): Observable<string> =>
+    defer(() => new Promise<void>(resolve => void setImmediate(resolve))).pipe(map(() => entry.id));
+
+describe('NestJSRxJSRedis xreadGroup$', () => {
+    it.each(counts)('COUNT %s', async count => {
+        const results = [];
+
+        for (const concurrency of concurrencies) {
+            const stream = `bench-stream-${count}-${concurrency}`;
+            const redis =
+                benchRedisUrl === undefined ? createMemoryClient() : await createRedisClient(benchRedisUrl, stream);
+            const consumer = new RedisStreamConsumer(redis, stream, 'bench', 'consumer', { count, concurrency });
+
+            const start = process.hrtime.bigint();
+            const ids = await lastValueFrom(consumer.consume$(handler$).pipe(take(ENTRIES), toArray()));
+            const totalMs = elapsedMs(start);
+
+            expect(ids).toHaveLength(ENTRIES);
+            results.push({ concurrency, 'entries/sec': Math.round((ENTRIES * MS_IN_SEC) / totalMs) });
+
+            if (benchRedisUrl !== undefined) {
+                await redis.del(stream);
+                redis.disconnect();
+            }
+        }
+
+        // eslint-disable-next-line no-console
+        console.table(results);
+    });
+});
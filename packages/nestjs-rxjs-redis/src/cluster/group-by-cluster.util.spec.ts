@@ -0,0 +1,36 @@
+import { describe, expect, it } from '@jest/globals';
+import calculateSlot from 'cluster-key-slot';
+
+import { groupByClusterNode, groupByClusterSlot } from './group-by-cluster.util';
+
+import type { Cluster } from 'ioredis';
+
+const keys = ['{a}1', '{b}1', '{a}2', 'c'];
+
+describe('groupByCluster', () => {
+    it('should group items by key slot', () => {
+        expect.assertions(1);
+
+        expect(groupByClusterSlot(keys, key => key)).toStrictEqual([['{a}1', '{a}2'], ['{b}1'], ['c']]);
+    });
+
+    it('should group items by cluster node', () => {
+        expect.assertions(1);
+
+        const slots: string[][] = [];
+        slots[calculateSlot('a')] = ['node1:6379', 'replica1:6379'];
+        slots[calculateSlot('b')] = ['node2:6379'];
+        slots[calculateSlot('c')] = ['node1:6379'];
+        const cluster = { slots } as unknown as Cluster;
+
+        expect(groupByClusterNode(cluster, keys, key => key)).toStrictEqual([['{a}1', '{a}2', 'c'], ['{b}1']]);
+    });
+
+    it('should group items by slot if cluster slots are not loaded', () => {
+        expect.assertions(1);
+
+        const cluster = { slots: [] } as unknown as Cluster;
+
+        expect(groupByClusterNode(cluster, keys, key => key)).toStrictEqual([['{a}1', '{a}2'], ['{b}1'], ['c']]);
+    });
+});
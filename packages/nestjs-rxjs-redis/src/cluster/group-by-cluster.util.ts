@@ -0,0 +1,24 @@
+import calculateSlot from 'cluster-key-slot';
+
+import { groupBy } from '@rnw-community/shared';
+
+import type { Cluster } from 'ioredis';
+
+/**
+ * Group items by cluster hash slot of their keys, multi-key commands are allowed only within one slot.
+ */
+export const groupByClusterSlot = <T>(items: T[], keyFn: (item: T) => string): T[][] => [
+    ...groupBy(items, item => calculateSlot(keyFn(item))).values(),
+];
+
+/**
+ * Group items by cluster master node serving their keys, so every group can be sent in one pipeline.
+ */
+export const groupByClusterNode = <T>(cluster: Cluster, items: T[], keyFn: (item: T) => string): T[][] => [
+    ...groupBy(items, item => {
+        const slot = calculateSlot(keyFn(item));
+
+        // HINT: Before slots are loaded keys are grouped by slot, cluster redirects them to the right node
+        return cluster.slots[slot]?.[0] ?? slot;
+    }).values(),
+];
@@ -0,0 +1,67 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { RedisCompressionEnum } from '../enum/redis-compression.enum';
+
+import { createCompressedCodec } from './compressed.codec';
+import { createJsonCodec } from './json.codec';
+import { createV8Codec } from './v8.codec';
+
+const smallValue = { id: 1, name: 'item' };
+const largeValue = { items: Array.from({ length: 100 }, (_, id) => ({ ...smallValue, id })) };
+const thresholdBytes = 100;
+const unknownCompression = 0xff;
+
+describe('redis codecs', () => {
+    it('json codec should encode value to buffer and back', () => {
+        expect.assertions(2);
+
+        const codec = createJsonCodec<typeof smallValue>();
+        const encoded = codec.encode(smallValue);
+
+        expect(encoded.toString('utf8')).toBe(JSON.stringify(smallValue));
+        expect(codec.decode(encoded)).toStrictEqual(smallValue);
+    });
+
+    it('v8 codec should encode value with Date and Map to buffer and back', () => {
+        expect.assertions(1);
+
+        const value = { date: new Date(0), map: new Map([['key', smallValue]]) };
+        const codec = createV8Codec<typeof value>();
+
+        expect(codec.decode(codec.encode(value))).toStrictEqual(value);
+    });
+
+    it.each([RedisCompressionEnum.Gzip, RedisCompressionEnum.Brotli])(
+        'compressed codec should compress values above threshold with %s compression',
+        compression => {
+            expect.assertions(4);
+
+            const jsonCodec = createJsonCodec<unknown>();
+            const codec = createCompressedCodec(jsonCodec, compression, thresholdBytes);
+            const encodedSmall = codec.encode(smallValue);
+            const encodedLarge = codec.encode(largeValue);
+
+            expect(encodedSmall[0]).toBe(RedisCompressionEnum.None);
+            expect(encodedLarge[0]).toBe(compression);
+            expect(encodedLarge.length).toBeLessThan(jsonCodec.encode(largeValue).length);
+            expect([codec.decode(encodedSmall), codec.decode(encodedLarge)]).toStrictEqual([smallValue, largeValue]);
+        }
+    );
+
+    it('compressed codec should decode values written with other compression', () => {
+        expect.assertions(1);
+
+        const jsonCodec = createJsonCodec<unknown>();
+        const gzipCodec = createCompressedCodec(jsonCodec, RedisCompressionEnum.Gzip, 0);
+
+        expect(createCompressedCodec(jsonCodec).decode(gzipCodec.encode(largeValue))).toStrictEqual(largeValue);
+    });
+
+    it('compressed codec should throw on unknown compression', () => {
+        expect.assertions(1);
+
+        const codec = createCompressedCodec(createJsonCodec<unknown>());
+
+        expect(() => codec.decode(Buffer.of(unknownCompression))).toThrow('Unknown redis value compression "255"');
+    });
+});
@@ -0,0 +1,52 @@
+import { brotliCompressSync, brotliDecompressSync, constants, gunzipSync, gzipSync } from 'zlib';
+
+import { isDefined } from '@rnw-community/shared';
+
+import { RedisCompressionEnum } from '../enum/redis-compression.enum';
+
+import type { RedisCodecInterface } from '../interface/redis-codec.interface';
+
+const BROTLI_FAST_QUALITY = 4;
+
+const compressors: Record<RedisCompressionEnum, (buffer: Buffer) => Buffer> = {
+    [RedisCompressionEnum.None]: buffer => buffer,
+    [RedisCompressionEnum.Gzip]: buffer => gzipSync(buffer, { level: constants.Z_BEST_SPEED }),
+    [RedisCompressionEnum.Brotli]: buffer =>
+        brotliCompressSync(buffer, { params: { [constants.BROTLI_PARAM_QUALITY]: BROTLI_FAST_QUALITY } }),
+};
+
+const decompressors: Record<RedisCompressionEnum, (buffer: Buffer) => Buffer> = {
+    [RedisCompressionEnum.None]: buffer => buffer,
+    [RedisCompressionEnum.Gzip]: buffer => gunzipSync(buffer),
+    [RedisCompressionEnum.Brotli]: buffer => brotliDecompressSync(buffer),
+};
+
+/**
+ * Wrap codec with compression of encoded values larger than `thresholdBytes`, compression type is stored
+ * in the first byte, so values written with any compression(or without it) can be decoded.
+ *
+ * @param codec Codec for encoding values to buffers
+ * @param compression Compression for values above the threshold
+ * @param thresholdBytes Minimal encoded value size for compression
+ */
+export const createCompressedCodec = <T>(
+    codec: RedisCodecInterface<T>,
+    compression = RedisCompressionEnum.Brotli,
+    thresholdBytes = 1024
+): RedisCodecInterface<T> => ({
+    encode: value => {
+        const encoded = codec.encode(value);
+        const type = encoded.length >= thresholdBytes ? compression : RedisCompressionEnum.None;
+
+        return Buffer.concat([Buffer.of(type), compressors[type](encoded)]);
+    },
+    decode: buffer => {
+        const decompress = decompressors[buffer[0] as RedisCompressionEnum] as ((input: Buffer) => Buffer) | undefined;
+
+        if (!isDefined(decompress)) {
+            throw new Error(`Unknown redis value compression "${String(buffer[0])}"`);
+        }
+
+        return codec.decode(decompress(buffer.subarray(1)));
+    },
+});
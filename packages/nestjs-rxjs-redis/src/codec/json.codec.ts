@@ -0,0 +1,10 @@
+import type { RedisCodecInterface } from '../interface/redis-codec.interface';
+
+/**
+ * JSON codec, `JSON.stringify`/`JSON.parse` work only with strings, so it costs the same as string values,
+ * use `createV8Codec` to skip the intermediate string.
+ */
+export const createJsonCodec = <T>(): RedisCodecInterface<T> => ({
+    encode: value => Buffer.from(JSON.stringify(value)),
+    decode: buffer => JSON.parse(buffer.toString('utf8')) as T,
+});
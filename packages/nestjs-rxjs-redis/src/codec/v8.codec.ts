@@ -0,0 +1,12 @@
+import { deserialize, serialize } from 'v8';
+
+import type { RedisCodecInterface } from '../interface/redis-codec.interface';
+
+/**
+ * Binary codec using V8 structured clone serialization, supports Date, Map, Set, typed arrays and circular references.
+ * Data can be decoded only by node processes with a compatible V8 version.
+ */
+export const createV8Codec = <T>(): RedisCodecInterface<T> => ({
+    encode: value => serialize(value),
+    decode: buffer => deserialize(buffer) as T,
+});
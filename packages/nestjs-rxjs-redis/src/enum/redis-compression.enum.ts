@@ -0,0 +1,6 @@
+// HINT: Value is stored in the first byte of the encoded buffer
+export enum RedisCompressionEnum {
+    None = 0,
+    Gzip = 1,
+    Brotli = 2,
+}
@@ -1,2 +1,15 @@
+export * from './nestjs-rxjs-redis-module.options';
+export * from './codec/compressed.codec';
+export * from './codec/json.codec';
+export * from './codec/v8.codec';
+export * from './enum/redis-compression.enum';
+export * from './redis-script/redis-script';
+export type { RedisCodecInterface } from './interface/redis-codec.interface';
+export type { RedisAutoBatchStatsInterface } from './interface/redis-auto-batch-stats.interface';
+export type { RedisStreamConsumerOptionsInterface } from './interface/redis-stream-consumer-options.interface';
+export type { RedisStreamEntryInterface } from './interface/redis-stream-entry.interface';
+export type { RedisL1CacheStatsInterface } from './interface/redis-l1-cache-stats.interface';
+export type { RedisVersionedValueInterface } from './interface/redis-versioned-value.interface';
+
 export { NestJSRxJSRedisService } from './nestjs-rxjs-redis-service/nestjs-rxjs-redis.service';
 export { NestJSRxJSRedisModule } from './nestjs-rxjs-redis.module';
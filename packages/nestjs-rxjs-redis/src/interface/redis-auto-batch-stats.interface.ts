@@ -0,0 +1,11 @@
+export interface RedisAutoBatchStatsInterface {
+    // Number of sent pipelines
+    batches: number;
+    // Number of commands sent through pipelines
+    commands: number;
+    // Time from the first queued command until the pipeline reply, in milliseconds
+    lastFlushLatencyMs: number;
+    maxBatchSize: number;
+    maxFlushLatencyMs: number;
+    totalFlushLatencyMs: number;
+}
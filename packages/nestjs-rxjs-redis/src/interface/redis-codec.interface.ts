@@ -0,0 +1,4 @@
+export interface RedisCodecInterface<T> {
+    decode: (buffer: Buffer) => T;
+    encode: (value: T) => Buffer;
+}
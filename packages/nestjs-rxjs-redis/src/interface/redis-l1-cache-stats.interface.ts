@@ -0,0 +1,11 @@
+export interface RedisL1CacheStatsInterface {
+    // Approximate memory used by cached keys and values
+    bytes: number;
+    entries: number;
+    // Entries removed to stay within `l1CacheMaxBytes`
+    evictions: number;
+    hits: number;
+    // Entries removed by redis client tracking invalidation messages
+    invalidations: number;
+    misses: number;
+}
@@ -0,0 +1,5 @@
+export interface RedisMsetEntryInterface {
+    key: string;
+    ttlInSeconds: number;
+    value: string;
+}
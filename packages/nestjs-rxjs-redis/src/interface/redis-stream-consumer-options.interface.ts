@@ -0,0 +1,11 @@
+export interface RedisStreamConsumerOptionsInterface {
+    // Maximal time XREADGROUP waits for new entries, 0 waits forever(or claimMinIdleInMs if recovery is enabled)
+    blockInMs: number;
+    // Minimal idle time of pending entries claimed by XAUTOCLAIM(requires redis 6.2), 0 disables recovery, so failed
+    // entries are never retried
+    claimMinIdleInMs: number;
+    // Maximal number of entries handled in parallel
+    concurrency: number;
+    // Maximal number of entries returned by one XREADGROUP/XAUTOCLAIM
+    count: number;
+}
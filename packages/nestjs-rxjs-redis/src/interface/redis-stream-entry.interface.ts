@@ -0,0 +1,4 @@
+export interface RedisStreamEntryInterface {
+    fields: Record<string, string>;
+    id: string;
+}
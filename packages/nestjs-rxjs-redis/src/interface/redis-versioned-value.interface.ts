@@ -0,0 +1,5 @@
+export interface RedisVersionedValueInterface {
+    value: string;
+    // Increased by every successful setIfVersion$, 0 for missing key
+    version: number;
+}
@@ -0,0 +1,7 @@
+export interface StaleCacheEntryInterface<T> {
+    // Time the prepareFn$ took to compute the value, in milliseconds
+    delta: number;
+    // Soft expiration timestamp, value is served stale and refreshed in background after it
+    expiresAt: number;
+    value: T;
+}
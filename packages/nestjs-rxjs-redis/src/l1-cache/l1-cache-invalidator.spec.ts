@@ -0,0 +1,117 @@
+import { EventEmitter } from 'events';
+
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { L1Cache } from './l1-cache';
+import { L1CacheInvalidator } from './l1-cache-invalidator';
+
+import type { Redis } from 'ioredis';
+
+const subscriberId = 42;
+
+const flushPromises = async (): Promise<void> => {
+    await new Promise(resolve => void setImmediate(resolve));
+};
+
+const getRedisClients = (
+    call = jest.fn<(...args: unknown[]) => Promise<unknown>>().mockResolvedValue('OK')
+): { redisClient: EventEmitter & Redis; subscriber: EventEmitter & Redis } => {
+    const subscriber = Object.assign(new EventEmitter(), {
+        call: jest.fn<() => Promise<unknown>>().mockResolvedValue(subscriberId),
+        disconnect: jest.fn(),
+        subscribe: jest.fn<() => Promise<unknown>>().mockResolvedValue(1),
+    }) as unknown as EventEmitter & Redis;
+    const redisClient = Object.assign(new EventEmitter(), {
+        call,
+        duplicate: jest.fn().mockReturnValue(subscriber),
+    }) as unknown as EventEmitter & Redis;
+
+    return { redisClient, subscriber };
+};
+
+describe('L1CacheInvalidator', () => {
+    it('should enable tracking and L1 cache when subscriber is ready', async () => {
+        expect.assertions(3);
+
+        const { redisClient, subscriber } = getRedisClients();
+        const cache = new L1Cache(1000);
+        // eslint-disable-next-line no-new
+        new L1CacheInvalidator(redisClient, cache);
+
+        subscriber.emit('ready');
+        await flushPromises();
+
+        expect(subscriber.subscribe).toHaveBeenCalledWith('__redis__:invalidate');
+        expect(redisClient.call).toHaveBeenCalledWith('CLIENT', 'TRACKING', 'ON', 'REDIRECT', String(subscriberId));
+        expect(cache.isEnabled).toBe(true);
+    });
+
+    it('should invalidate keys from tracking messages', async () => {
+        expect.assertions(2);
+
+        const { redisClient, subscriber } = getRedisClients();
+        const cache = new L1Cache(1000);
+        // eslint-disable-next-line no-new
+        new L1CacheInvalidator(redisClient, cache);
+
+        subscriber.emit('ready');
+        await flushPromises();
+        cache.set('a', '1', cache.getVersion('a'));
+        cache.set('b', '2', cache.getVersion('b'));
+        subscriber.emit('message', 'other-channel', ['b']);
+        subscriber.emit('message', '__redis__:invalidate', ['a']);
+        subscriber.emit('message', '__redis__:invalidate', 'c');
+
+        expect(cache.get('a')).toBeUndefined();
+        expect(cache.get('b')).toBe('2');
+    });
+
+    it('should disable L1 cache when any connection is lost and on tracking error', async () => {
+        expect.assertions(3);
+
+        const call = jest.fn<(...args: unknown[]) => Promise<unknown>>().mockResolvedValue('OK');
+        const { redisClient, subscriber } = getRedisClients(call);
+        const cache = new L1Cache(1000);
+        // eslint-disable-next-line no-new
+        new L1CacheInvalidator(redisClient, cache);
+
+        subscriber.emit('ready');
+        await flushPromises();
+        redisClient.emit('close');
+
+        expect(cache.isEnabled).toBe(false);
+
+        call.mockRejectedValueOnce(new Error('ERR unknown command'));
+        redisClient.emit('ready');
+        await flushPromises();
+
+        expect(cache.isEnabled).toBe(false);
+
+        subscriber.emit('close');
+        redisClient.emit('ready');
+        await flushPromises();
+
+        expect(cache.isEnabled).toBe(false);
+    });
+
+    it('should disable L1 cache if subscriber cannot subscribe and on close', async () => {
+        expect.assertions(3);
+
+        const { redisClient, subscriber } = getRedisClients();
+        jest.mocked(subscriber.subscribe).mockRejectedValueOnce(new Error('Connection is closed'));
+        const cache = new L1Cache(1000);
+        const invalidator = new L1CacheInvalidator(redisClient, cache);
+
+        subscriber.emit('ready');
+        await flushPromises();
+
+        expect(cache.isEnabled).toBe(false);
+
+        subscriber.emit('ready');
+        await flushPromises();
+        invalidator.close();
+
+        expect(cache.isEnabled).toBe(false);
+        expect(subscriber.disconnect).toHaveBeenCalledTimes(1);
+    });
+});
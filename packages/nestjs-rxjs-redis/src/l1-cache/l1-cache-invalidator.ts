@@ -0,0 +1,76 @@
+import { isDefined } from '@rnw-community/shared';
+
+import type { L1Cache } from './l1-cache';
+import type { Redis } from 'ioredis';
+
+const INVALIDATE_CHANNEL = '__redis__:invalidate';
+
+/**
+ * Keeps L1 cache coherent using redis 6 `CLIENT TRACKING` in RESP2 redirect mode: keys read by the main
+ * connection are tracked by redis and invalidation messages are delivered to a dedicated subscriber connection.
+ *
+ * Tracking is bound to connections, so L1 cache is disabled whenever any of them is lost
+ * and enabled again only after tracking is re-established.
+ *
+ * @see https://redis.io/docs/manual/client-side-caching/
+ */
+export class L1CacheInvalidator {
+    private readonly subscriber: Redis;
+    private subscriberId?: string;
+
+    constructor(
+        private readonly redisClient: Redis,
+        private readonly l1Cache: L1Cache
+    ) {
+        this.subscriber = redisClient.duplicate({ autoResubscribe: false });
+
+        this.subscriber.on('message', (channel: string, keys: string[] | string | null) => {
+            if (channel === INVALIDATE_CHANNEL) {
+                this.l1Cache.invalidate(typeof keys === 'string' ? [keys] : keys);
+            }
+        });
+        this.subscriber.on('ready', () => void this.subscribe());
+        this.subscriber.on('close', () => {
+            this.subscriberId = undefined;
+            this.l1Cache.disable();
+        });
+        this.redisClient.on('ready', () => void this.enableTracking());
+        this.redisClient.on('close', () => void this.l1Cache.disable());
+    }
+
+    async enableTracking(): Promise<void> {
+        this.l1Cache.disable();
+
+        if (!isDefined(this.subscriberId)) {
+            return;
+        }
+
+        try {
+            await this.redisClient.call('CLIENT', 'TRACKING', 'ON', 'REDIRECT', this.subscriberId);
+
+            this.l1Cache.enable();
+        } catch {
+            // HINT: Without tracking L1 cache stays disabled and all reads go to redis
+            this.l1Cache.disable();
+        }
+    }
+
+    close(): void {
+        this.l1Cache.disable();
+        this.subscriber.disconnect();
+    }
+
+    private async subscribe(): Promise<void> {
+        try {
+            // HINT: Connection in subscriber mode cannot run other commands, so its id is read before subscribing
+            const subscriberId = await this.subscriber.call('CLIENT', 'ID');
+            await this.subscriber.subscribe(INVALIDATE_CHANNEL);
+            this.subscriberId = String(subscriberId);
+
+            await this.enableTracking();
+        } catch {
+            this.subscriberId = undefined;
+            this.l1Cache.disable();
+        }
+    }
+}
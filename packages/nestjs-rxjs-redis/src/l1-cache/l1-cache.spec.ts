@@ -0,0 +1,100 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { L1Cache } from './l1-cache';
+
+// HINT: Two one-char key/value entries with 64 bytes overhead each
+const twoEntriesBytes = 136;
+
+const getEnabledCache = (maxBytes = 1000): L1Cache => {
+    const cache = new L1Cache(maxBytes);
+    cache.enable();
+
+    return cache;
+};
+
+describe('L1Cache', () => {
+    it('should store values and count hits and misses', () => {
+        expect.assertions(3);
+
+        const cache = getEnabledCache();
+        cache.set('a', '1', cache.getVersion('a'));
+
+        expect(cache.get('a')).toBe('1');
+        expect(cache.get('b')).toBeUndefined();
+        expect(cache.getStats()).toMatchObject({ hits: 1, misses: 1, entries: 1 });
+    });
+
+    it('should not store or return values while disabled', () => {
+        expect.assertions(3);
+
+        const cache = new L1Cache(1000);
+        cache.set('a', '1', cache.getVersion('a'));
+
+        expect(cache.isEnabled).toBe(false);
+        expect(cache.get('a')).toBeUndefined();
+        expect(cache.getStats()).toMatchObject({ hits: 0, misses: 0, entries: 0 });
+    });
+
+    it('should evict least recently used values above max bytes', () => {
+        expect.assertions(4);
+
+        const cache = getEnabledCache(twoEntriesBytes);
+        cache.set('a', '1', cache.getVersion('a'));
+        cache.set('b', '2', cache.getVersion('b'));
+        cache.get('a');
+        cache.set('c', '3', cache.getVersion('c'));
+
+        expect(cache.get('a')).toBe('1');
+        expect(cache.get('b')).toBeUndefined();
+        expect(cache.get('c')).toBe('3');
+        expect(cache.getStats()).toMatchObject({ bytes: twoEntriesBytes, entries: 2, evictions: 1 });
+    });
+
+    it('should not store values larger than max bytes', () => {
+        expect.assertions(1);
+
+        const cache = getEnabledCache(1);
+        cache.set('a', '1', cache.getVersion('a'));
+
+        expect(cache.get('a')).toBeUndefined();
+    });
+
+    it('should invalidate keys and ignore values read before invalidation', () => {
+        expect.assertions(3);
+
+        const cache = getEnabledCache();
+        const readVersion = cache.getVersion('b');
+        cache.set('a', '1', cache.getVersion('a'));
+        cache.invalidate(['a', 'b']);
+        cache.set('b', '2', readVersion);
+
+        expect(cache.get('a')).toBeUndefined();
+        expect(cache.get('b')).toBeUndefined();
+        expect(cache.getStats()).toMatchObject({ invalidations: 1, entries: 0, bytes: 0 });
+    });
+
+    it('should store values read before invalidation of other keys', () => {
+        expect.assertions(2);
+
+        const cache = getEnabledCache();
+        const readVersion = cache.getVersion('a');
+        cache.invalidate(['b', 'c']);
+        cache.set('a', '1', readVersion);
+
+        expect(cache.getVersion('b')).toBe(1);
+        expect(cache.get('a')).toBe('1');
+    });
+
+    it('should clear all values on database flush', () => {
+        expect.assertions(2);
+
+        const cache = getEnabledCache();
+        const readVersion = cache.getVersion('b');
+        cache.set('a', '1', cache.getVersion('a'));
+        cache.invalidate(null);
+        cache.set('b', '2', readVersion);
+
+        expect(cache.get('a')).toBeUndefined();
+        expect(cache.get('b')).toBeUndefined();
+    });
+});
@@ -0,0 +1,156 @@
+import { isDefined } from '@rnw-community/shared';
+
+import type { RedisL1CacheStatsInterface } from '../interface/redis-l1-cache-stats.interface';
+
+// HINT: JS strings are UTF-16, plus rough Map entry overhead
+const BYTES_PER_CHAR = 2;
+const ENTRY_OVERHEAD_BYTES = 64;
+// HINT: Power of two, so slot is calculated with a bit mask
+const VERSION_SLOTS = 4096;
+const FNV_OFFSET_BASIS = 0x811c9dc5;
+const FNV_PRIME = 0x01000193;
+
+// FNV-1a string hash
+const getVersionSlot = (key: string): number => {
+    let hash = FNV_OFFSET_BASIS;
+    for (let idx = 0; idx < key.length; idx++) {
+        hash = Math.imul(hash ^ key.charCodeAt(idx), FNV_PRIME);
+    }
+
+    return (hash >>> 0) & (VERSION_SLOTS - 1);
+};
+
+const getEntryBytes = (key: string, value: string): number =>
+    (key.length + value.length) * BYTES_PER_CHAR + ENTRY_OVERHEAD_BYTES;
+
+/**
+ * In-process LRU cache of redis string values bounded by approximate size in bytes.
+ *
+ * Cache is disabled until redis invalidation is available, so stale values are never served.
+ * Invalidation increases version of the key slot, values of the slot read from redis before the invalidation are
+ * not stored, so writes of unrelated keys do not prevent caching.
+ */
+export class L1Cache {
+    private readonly versions = new Uint32Array(VERSION_SLOTS);
+    private readonly entries = new Map<string, string>();
+    private enabled = false;
+
+    private readonly stats: RedisL1CacheStatsInterface = {
+        bytes: 0,
+        entries: 0,
+        evictions: 0,
+        hits: 0,
+        invalidations: 0,
+        misses: 0,
+    };
+
+    constructor(private readonly maxBytes: number) {}
+
+    get isEnabled(): boolean {
+        return this.enabled;
+    }
+
+    /**
+     * Version of the key slot, pass it to `set` for the value read from redis.
+     */
+    getVersion(key: string): number {
+        return this.versions[getVersionSlot(key)];
+    }
+
+    get(key: string): string | undefined {
+        if (!this.enabled) {
+            return undefined;
+        }
+
+        const value = this.entries.get(key);
+
+        if (isDefined(value)) {
+            this.stats.hits += 1;
+            // HINT: Map keeps insertion order, re-inserting marks entry as the most recently used
+            this.entries.delete(key);
+            this.entries.set(key, value);
+        } else {
+            this.stats.misses += 1;
+        }
+
+        return value;
+    }
+
+    set(key: string, value: string, readVersion: number): void {
+        const bytes = getEntryBytes(key, value);
+
+        if (!this.enabled || readVersion !== this.getVersion(key) || bytes > this.maxBytes) {
+            return;
+        }
+
+        this.remove(key);
+        this.entries.set(key, value);
+        this.stats.bytes += bytes;
+
+        for (const [oldestKey] of this.entries) {
+            if (this.stats.bytes <= this.maxBytes) {
+                break;
+            }
+
+            this.remove(oldestKey);
+            this.stats.evictions += 1;
+        }
+
+        this.stats.entries = this.entries.size;
+    }
+
+    /**
+     * Remove keys changed in redis, `null` means the whole redis database was flushed.
+     */
+    invalidate(keys: string[] | null): void {
+        if (keys === null) {
+            this.clear();
+        } else {
+            keys.forEach(key => {
+                this.versions[getVersionSlot(key)] += 1;
+
+                if (this.remove(key)) {
+                    this.stats.invalidations += 1;
+                }
+            });
+        }
+
+        this.stats.entries = this.entries.size;
+    }
+
+    enable(): void {
+        this.clear();
+        this.enabled = true;
+    }
+
+    disable(): void {
+        this.clear();
+        this.enabled = false;
+    }
+
+    getStats(): RedisL1CacheStatsInterface {
+        return { ...this.stats };
+    }
+
+    private clear(): void {
+        for (let slot = 0; slot < VERSION_SLOTS; slot++) {
+            this.versions[slot] += 1;
+        }
+        this.entries.clear();
+        this.stats.bytes = 0;
+        this.stats.entries = 0;
+    }
+
+    private remove(key: string): boolean {
+        const value = this.entries.get(key);
+
+        if (!isDefined(value)) {
+            return false;
+        }
+
+        this.entries.delete(key);
+        this.stats.bytes -= getEntryBytes(key, value);
+
+        return true;
+    }
+}
@@ -1,6 +1,7 @@
 import { Global, Module } from '@nestjs/common';
 import { RedisModule } from '@nestjs-modules/ioredis';
 
+import { NESTJS_RXJS_REDIS_MODULE_OPTIONS, type NestJSRxJSRedisModuleOptions } from './nestjs-rxjs-redis-module.options';
 import { NestJSRxJSRedisService } from './nestjs-rxjs-redis-service/nestjs-rxjs-redis.service';
 
 import type { DynamicModule } from '@nestjs/common';
@@ -12,10 +13,14 @@ import type { RedisModuleAsyncOptions } from '@nestjs-modules/ioredis';
     exports: [NestJSRxJSRedisService],
 })
 export class NestJSRxJSRedisCoreModule {
-    static forRootAsync(options: RedisModuleAsyncOptions): DynamicModule {
+    static forRootAsync(
+        options: RedisModuleAsyncOptions,
+        redisOptions: Partial<NestJSRxJSRedisModuleOptions> = {}
+    ): DynamicModule {
         return {
             module: NestJSRxJSRedisCoreModule,
             imports: [RedisModule.forRootAsync(options)],
+            providers: [{ provide: NESTJS_RXJS_REDIS_MODULE_OPTIONS, useValue: redisOptions }],
             exports: [NestJSRxJSRedisService],
         };
     }
@@ -0,0 +1,41 @@
+export const NESTJS_RXJS_REDIS_MODULE_OPTIONS = 'NESTJS_RXJS_REDIS_MODULE_OPTIONS';
+
+export interface NestJSRxJSRedisModuleOptions {
+    // Collect get$/set$/getBuffer$/setBuffer$/del$/incr$ commands issued in the same event loop iteration into one pipeline
+    autoBatch: boolean;
+    // Wait for more commands before sending the batch, 0 sends it on the next event loop iteration
+    autoBatchWindowInMs: number;
+    // Send the batch right away when it reaches this number of commands, without waiting for the window end
+    autoBatchMaxSize: number;
+    // Share one cache operator prepareFn$ result or error per key between all concurrent subscribers of this instance
+    cacheSingleflight: boolean;
+    // Acquire a redis lease before running cache() prepareFn$, so only one instance recomputes expired key
+    cacheLease: boolean;
+    // Lease expiration, instances that failed to acquire the lease wait for the value at most this time
+    cacheLeaseTtlInMs: number;
+    // Delay between checks for the value recomputed by the lease holder
+    cacheLeaseRetryDelayInMs: number;
+    // swrCache() XFetch early refresh aggressiveness, values above 1 favor earlier refreshes, 0 disables them
+    cacheEarlyExpirationBeta: number;
+    // Keep get$ values in the in-process LRU cache, kept coherent with redis 6 CLIENT TRACKING invalidation
+    l1Cache: boolean;
+    // Approximate L1 cache size limit, least recently used values are evicted above it
+    l1CacheMaxBytes: number;
+    // Read get$/getBuffer$/mget$ from replicas: cluster connection with `scaleReads: 'slave'` or sentinel replica
+    readFromReplica: boolean;
+}
+
+export const defaultNestJSRxJSRedisModuleOptions: NestJSRxJSRedisModuleOptions = {
+    autoBatch: false,
+    autoBatchWindowInMs: 0,
+    autoBatchMaxSize: 1000,
+    cacheSingleflight: false,
+    cacheLease: false,
+    cacheLeaseTtlInMs: 5000,
+    cacheLeaseRetryDelayInMs: 50,
+    cacheEarlyExpirationBeta: 1,
+    l1Cache: false,
+    // 64MB
+    l1CacheMaxBytes: 67_108_864,
+    readFromReplica: false,
+};
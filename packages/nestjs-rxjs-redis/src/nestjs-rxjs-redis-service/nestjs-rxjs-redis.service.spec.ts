@@ -1,9 +1,22 @@
 /* eslint-disable max-lines */
+import { EventEmitter } from 'events';
+
 import { describe, expect, it, jest } from '@jest/globals';
-import { of } from 'rxjs';
+import { Logger } from '@nestjs/common';
+import calculateSlot from 'cluster-key-slot';
+import { Subject, lastValueFrom, map, of, take, tap, throwError, toArray } from 'rxjs';
 
 import { emptyFn, getErrorMessage } from '@rnw-community/shared';
 
+import { createJsonCodec } from '../codec/json.codec';
+import { defaultNestJSRxJSRedisModuleOptions } from '../nestjs-rxjs-redis-module.options';
+import {
+    getAndTouchScript,
+    incrWithTtlScript,
+    releaseLeaseScript,
+    setIfVersionScript,
+} from '../redis-script/redis-scripts';
+
 import { NestJSRxJSRedisService } from './nestjs-rxjs-redis.service';
 
 import type { Redis } from 'ioredis';
@@ -11,12 +24,17 @@ import type { Redis } from 'ioredis';
 const redisKey = 'testKey';
 const redisValue = 'testValue';
 const redisTTLValue = 100;
+const concurrentRequests = 100;
+const staleTTLValue = 10;
+const getStaleCacheEntry = (expiresIn: number, value = redisValue): string =>
+    `${Date.now() + expiresIn}:0:${JSON.stringify(value)}`;
 
-type RedisClient = Partial<Pick<Redis, 'del' | 'expire' | 'get' | 'incr' | 'mget' | 'set' | 'ttl'>>;
+type RedisClient = Partial<Pick<Redis, 'del' | 'expire' | 'get' | 'getBuffer' | 'incr' | 'mget' | 'set' | 'ttl'>>;
 const getRedisService = (redisClient?: RedisClient): Redis =>
     // eslint-disable-next-line @typescript-eslint/consistent-type-assertions
     ({
         get: jest.fn<Redis['get']>().mockResolvedValue(redisValue),
+        getBuffer: jest.fn<Redis['getBuffer']>().mockResolvedValue(Buffer.from(redisValue)),
         set: jest.fn<Redis['set']>().mockResolvedValue('OK'),
         del: jest.fn<Redis['del']>().mockResolvedValue(1),
         mget: jest.fn<Redis['mget']>().mockResolvedValue([redisValue]),
@@ -26,6 +44,20 @@ const getRedisService = (redisClient?: RedisClient): Redis =>
         ...redisClient,
     }) as Redis;
 
+type PipelineReplies = Array<[Error | null, unknown]> | null;
+
+const getClusterClient = (
+    exec: () => Promise<PipelineReplies>,
+    client: Record<string, unknown> = {}
+): { cluster: Redis; pipeline: jest.Mock } => {
+    const slots: string[][] = [];
+    slots[calculateSlot('a')] = ['node1:6379'];
+    slots[calculateSlot('b')] = ['node2:6379'];
+    const pipeline = jest.fn().mockReturnValue({ exec });
+
+    return { cluster: { ...getRedisService(), isCluster: true, slots, pipeline, ...client } as unknown as Redis, pipeline };
+};
+
 // eslint-disable-next-line max-lines-per-function,max-statements
 describe('NestJSRxJSRedisService', () => {
     it('get$ operation should create observable', done => {
@@ -175,6 +207,368 @@ describe('NestJSRxJSRedisService', () => {
         });
     });
 
+    it('mget$ operation should propagate redis client error', async () => {
+        expect.assertions(1);
+
+        const error = new Error('FAIL');
+        const mget = jest.fn<Redis['mget']>().mockRejectedValue(error);
+        const redis = new NestJSRxJSRedisService(getRedisService({ mget } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.mget$([redisKey]))).rejects.toBe(error);
+    });
+
+    it('mgetChunked$ operation should emit result for each chunk', async () => {
+        expect.assertions(3);
+
+        const mget = jest.fn((keys: string[]) => Promise.resolve(keys.map(key => `${key}-value`)));
+        const redis = new NestJSRxJSRedisService(getRedisService({ mget } as unknown as RedisClient));
+
+        const results = await lastValueFrom(redis.mgetChunked$(['a', 'b', 'c'], 2).pipe(toArray()));
+
+        expect(mget).toHaveBeenNthCalledWith(1, ['a', 'b']);
+        expect(mget).toHaveBeenNthCalledWith(2, ['c']);
+        expect(results).toStrictEqual([{ a: 'a-value', b: 'b-value' }, { c: 'c-value' }]);
+    });
+
+    it('mgetChunked$ operation should throw on invalid chunk size', async () => {
+        expect.assertions(2);
+
+        const mget = jest.fn<Redis['mget']>();
+        const redis = new NestJSRxJSRedisService(getRedisService({ mget } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.mgetChunked$(['a'], 0))).rejects.toThrow('Invalid chunk size "0"');
+        expect(mget).not.toHaveBeenCalled();
+    });
+
+    it('mset$ operation should set keys with individual TTLs in one pipeline', async () => {
+        expect.assertions(2);
+
+        const exec = jest.fn().mockResolvedValue([
+            [null, 'OK'],
+            [null, 'OK'],
+        ]);
+        const pipeline = jest.fn().mockReturnValue({ exec });
+        const redis = new NestJSRxJSRedisService({ ...getRedisService(), pipeline } as unknown as Redis);
+
+        await expect(
+            lastValueFrom(
+                redis.mset$([
+                    { key: 'a', value: '1', ttlInSeconds: 1 },
+                    { key: 'b', value: '2', ttlInSeconds: redisTTLValue },
+                ])
+            )
+        ).resolves.toBe(true);
+        expect(pipeline).toHaveBeenCalledWith([
+            ['set', 'a', '1', 'EX', 1],
+            ['set', 'b', '2', 'EX', redisTTLValue],
+        ]);
+    });
+
+    it.each([[[[null, 'OK'], [new Error('FAIL'), null]]], [null]])(
+        'mset$ operation should throw if any key was not set, replies: %j',
+        async replies => {
+            expect.assertions(1);
+
+            const pipeline = jest.fn().mockReturnValue({ exec: jest.fn().mockResolvedValue(replies) });
+            const redis = new NestJSRxJSRedisService({ ...getRedisService(), pipeline } as unknown as Redis);
+            const entries = [
+                { key: 'a', value: '1', ttlInSeconds: 1 },
+                { key: 'b', value: '2', ttlInSeconds: 1 },
+            ];
+
+            await expect(lastValueFrom(redis.mset$(entries))).rejects.toThrow('Error setting 2 keys to redis');
+        }
+    );
+
+    it('scan$ operation should emit batches and send next SCAN after batch is handled', async () => {
+        expect.assertions(3);
+
+        const scan = jest
+            .fn<() => Promise<[string, string[]]>>()
+            .mockResolvedValueOnce(['1', ['a', 'b']])
+            .mockResolvedValueOnce(['2', []])
+            .mockResolvedValueOnce(['0', ['c']]);
+        const redis = new NestJSRxJSRedisService(getRedisService({ scan } as unknown as RedisClient));
+        const scanCalls: number[] = [];
+
+        const batches = await lastValueFrom(
+            redis.scan$('prefix:*', 2).pipe(
+                tap(() => void scanCalls.push(scan.mock.calls.length)),
+                toArray()
+            )
+        );
+
+        expect(batches).toStrictEqual([['a', 'b'], ['c']]);
+        expect(scanCalls).toStrictEqual([1, 3]);
+        expect(scan).toHaveBeenNthCalledWith(2, '1', 'MATCH', 'prefix:*', 'COUNT', 2);
+    });
+
+    it('scanEach$ operation should send next SCAN only after batch handler completes', async () => {
+        expect.assertions(2);
+
+        const scan = jest
+            .fn<() => Promise<[string, string[]]>>()
+            .mockResolvedValueOnce(['1', ['a']])
+            .mockResolvedValueOnce(['0', ['b']]);
+        const redis = new NestJSRxJSRedisService(getRedisService({ scan } as unknown as RedisClient));
+        const handled = new Subject<number>();
+
+        const results = lastValueFrom(redis.scanEach$('*', keys => handled.pipe(take(1), map(() => keys))).pipe(toArray()));
+        await new Promise(resolve => void setImmediate(resolve));
+
+        expect(scan).toHaveBeenCalledTimes(1);
+
+        handled.next(1);
+        await new Promise(resolve => void setImmediate(resolve));
+        handled.next(1);
+
+        await expect(results).resolves.toStrictEqual([['a'], ['b']]);
+    });
+
+    it('hscan$, sscan$ and zscan$ operations should parse batches', async () => {
+        expect.assertions(3);
+
+        const hscan = jest.fn<() => Promise<[string, string[]]>>().mockResolvedValue(['0', ['field', 'value']]);
+        const sscan = jest.fn<() => Promise<[string, string[]]>>().mockResolvedValue(['0', ['member']]);
+        const zscan = jest.fn<() => Promise<[string, string[]]>>().mockResolvedValue(['0', ['member', '1.5']]);
+        const redis = new NestJSRxJSRedisService(getRedisService({ hscan, sscan, zscan } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.hscan$(redisKey))).resolves.toStrictEqual([['field', 'value']]);
+        await expect(lastValueFrom(redis.sscan$(redisKey))).resolves.toStrictEqual(['member']);
+        await expect(lastValueFrom(redis.zscan$(redisKey))).resolves.toStrictEqual([['member', 1.5]]);
+    });
+
+    it('scan$ operation when redis client throws error', async () => {
+        expect.assertions(1);
+
+        const scan = jest.fn<() => Promise<[string, string[]]>>().mockRejectedValue(new Error('FAIL'));
+        const redis = new NestJSRxJSRedisService(getRedisService({ scan } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.scan$('prefix:*'))).rejects.toThrow('Error scanning prefix:* keys in redis');
+    });
+
+    it('deleteByPattern$ operation should unlink scanned keys in chunks', async () => {
+        expect.assertions(3);
+
+        const scan = jest
+            .fn<() => Promise<[string, string[]]>>()
+            .mockResolvedValueOnce(['1', ['a', 'b', 'c']])
+            .mockResolvedValueOnce(['0', ['d']]);
+        const unlink = jest.fn((keys: string[]) => Promise.resolve(keys.length));
+        const del = jest.fn((keys: string[]) => Promise.resolve(keys.length));
+        const redis = new NestJSRxJSRedisService(getRedisService({ del, scan, unlink } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.deleteByPattern$('prefix:*', 3, 2))).resolves.toBe(4);
+        expect(unlink.mock.calls).toStrictEqual([[['a', 'b']], [['c']], [['d']]]);
+        expect(del).not.toHaveBeenCalled();
+    });
+
+    it('deleteByPattern$ operation should use DEL and throw errors', async () => {
+        expect.assertions(2);
+
+        const scan = jest.fn<() => Promise<[string, string[]]>>().mockResolvedValue(['0', ['a']]);
+        const del = jest.fn<() => Promise<number>>().mockRejectedValue(new Error('FAIL'));
+        const redis = new NestJSRxJSRedisService(getRedisService({ del, scan } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.deleteByPattern$('prefix:*', 1, 1, 1, false))).rejects.toThrow(
+            'Error deleting prefix:* keys from redis'
+        );
+        expect(del).toHaveBeenCalledWith(['a']);
+    });
+
+    it('mget$ operation in cluster mode should send pipeline of MGET per slot to every node', async () => {
+        expect.assertions(3);
+
+        const exec = jest
+            .fn<() => Promise<PipelineReplies>>()
+            .mockResolvedValueOnce([[null, ['a1', 'a2']]])
+            .mockResolvedValueOnce([[null, ['b1']]]);
+        const { cluster, pipeline } = getClusterClient(exec);
+        const redis = new NestJSRxJSRedisService(cluster, { autoBatch: true, l1Cache: true });
+
+        await expect(lastValueFrom(redis.mget$(['{a}1', '{b}1', '{a}2']))).resolves.toStrictEqual({
+            '{a}1': 'a1',
+            '{a}2': 'a2',
+            '{b}1': 'b1',
+        });
+        expect(pipeline.mock.calls).toStrictEqual([[[['mget', '{a}1', '{a}2']]], [[['mget', '{b}1']]]]);
+        expect(redis.getAutoBatchStats()).toBeUndefined();
+    });
+
+    it.each([
+        [[[new Error('CROSSSLOT'), null]], 'CROSSSLOT'],
+        [null, 'Missing redis pipeline reply'],
+    ] as Array<[PipelineReplies, string]>)(
+        'mget$ operation in cluster mode should throw pipeline error, replies: %j',
+        async (replies, error) => {
+            expect.assertions(1);
+
+            const { cluster } = getClusterClient(jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue(replies));
+            const redis = new NestJSRxJSRedisService(cluster);
+
+            await expect(lastValueFrom(redis.mget$(['{a}1']))).rejects.toThrow(error);
+        }
+    );
+
+    it('mget$ and mset$ operations in cluster mode should handle empty keys', async () => {
+        expect.assertions(2);
+
+        const { cluster } = getClusterClient(jest.fn<() => Promise<PipelineReplies>>());
+        const redis = new NestJSRxJSRedisService(cluster);
+
+        await expect(lastValueFrom(redis.mget$([]))).resolves.toStrictEqual({});
+        await expect(lastValueFrom(redis.mset$([]))).resolves.toBe(true);
+    });
+
+    it('mset$ operation in cluster mode should send pipeline to every node', async () => {
+        expect.assertions(2);
+
+        const { cluster, pipeline } = getClusterClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue([[null, 'OK']])
+        );
+        const redis = new NestJSRxJSRedisService(cluster);
+
+        await expect(
+            lastValueFrom(
+                redis.mset$([
+                    { key: '{a}1', value: '1', ttlInSeconds: 1 },
+                    { key: '{b}1', value: '2', ttlInSeconds: 1 },
+                ])
+            )
+        ).resolves.toBe(true);
+        expect(pipeline.mock.calls).toStrictEqual([[[['set', '{a}1', '1', 'EX', 1]]], [[['set', '{b}1', '2', 'EX', 1]]]]);
+    });
+
+    it('scan$ and deleteByPattern$ in cluster mode should scan every master and delete keys per slot', async () => {
+        expect.assertions(3);
+
+        const getNode = (keys: string[]): Record<string, jest.Mock> => ({
+            scan: jest.fn<() => Promise<[string, string[]]>>().mockResolvedValue(['0', keys]),
+        });
+        const nodes = [getNode(['{a}1', '{b}1', '{a}2']), getNode(['{b}2'])];
+        const unlink = jest.fn((keys: string[]) => Promise.resolve(keys.length));
+        const { cluster } = getClusterClient(jest.fn<() => Promise<PipelineReplies>>(), {
+            nodes: jest.fn().mockReturnValue(nodes),
+            unlink,
+        });
+        const redis = new NestJSRxJSRedisService(cluster);
+
+        await expect(lastValueFrom(redis.scan$('*').pipe(toArray()))).resolves.toStrictEqual([
+            ['{a}1', '{b}1', '{a}2'],
+            ['{b}2'],
+        ]);
+        await expect(lastValueFrom(redis.deleteByPattern$('*'))).resolves.toBe(4);
+        expect(unlink.mock.calls).toStrictEqual([[['{a}1', '{a}2']], [['{b}1']], [['{b}2']]]);
+    });
+
+    it('should read from replica with readFromReplica option', async () => {
+        expect.assertions(4);
+
+        const replica = {
+            disconnect: jest.fn(),
+            get: jest.fn<Redis['get']>().mockResolvedValue('replicaValue'),
+            getBuffer: jest.fn<Redis['getBuffer']>().mockResolvedValue(Buffer.from('replicaValue')),
+            mget: jest.fn<Redis['mget']>().mockResolvedValue(['replicaValue']),
+        };
+        const redisService = {
+            ...getRedisService(),
+            duplicate: jest.fn().mockReturnValue(replica),
+            isCluster: false,
+            options: { sentinels: [{ host: 'sentinel' }] },
+        } as unknown as Redis;
+        const redis = new NestJSRxJSRedisService(redisService, { readFromReplica: true });
+
+        await expect(lastValueFrom(redis.get$(redisKey))).resolves.toBe('replicaValue');
+        await expect(lastValueFrom(redis.getBuffer$(redisKey))).resolves.toStrictEqual(Buffer.from('replicaValue'));
+        await expect(lastValueFrom(redis.mget$([redisKey]))).resolves.toStrictEqual({ [redisKey]: 'replicaValue' });
+
+        redis.onModuleDestroy();
+
+        expect(replica.disconnect).toHaveBeenCalledTimes(1);
+    });
+
+    it('incrWithTtl$ operation should increment value and set TTL in one script', async () => {
+        expect.assertions(2);
+
+        const evalsha = jest.fn<() => Promise<unknown>>().mockResolvedValue(1);
+        const redis = new NestJSRxJSRedisService(getRedisService({ evalsha } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.incrWithTtl$(redisKey, redisTTLValue))).resolves.toBe(1);
+        expect(evalsha).toHaveBeenCalledWith(incrWithTtlScript.sha, 1, redisKey, redisTTLValue);
+    });
+
+    it('script$ operation when redis client throws error', async () => {
+        expect.assertions(1);
+
+        const evalsha = jest.fn<() => Promise<unknown>>().mockRejectedValue(new Error('FAIL'));
+        const redis = new NestJSRxJSRedisService(getRedisService({ evalsha } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.incrWithTtl$(redisKey, 1))).rejects.toThrow(
+            `Error increment ${redisKey} from redis`
+        );
+    });
+
+    it('setIfVersion$ operation should return new version or null on version conflict', async () => {
+        expect.assertions(3);
+
+        const evalsha = jest.fn<() => Promise<unknown>>().mockResolvedValueOnce(2).mockResolvedValueOnce(-1);
+        const redis = new NestJSRxJSRedisService(getRedisService({ evalsha } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.setIfVersion$(redisKey, redisValue, 1, redisTTLValue))).resolves.toBe(2);
+        await expect(lastValueFrom(redis.setIfVersion$(redisKey, redisValue, 1, redisTTLValue))).resolves.toBeNull();
+        expect(evalsha).toHaveBeenCalledWith(setIfVersionScript.sha, 1, redisKey, redisValue, 1, redisTTLValue);
+    });
+
+    it('getWithVersion$ operation should return value with version', async () => {
+        expect.assertions(3);
+
+        const hmget = jest
+            .fn<() => Promise<Array<string | null>>>()
+            .mockResolvedValueOnce([redisValue, '2'])
+            .mockResolvedValueOnce([null, null]);
+        const redis = new NestJSRxJSRedisService(getRedisService({ hmget } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.getWithVersion$(redisKey))).resolves.toStrictEqual({
+            value: redisValue,
+            version: 2,
+        });
+        await expect(lastValueFrom(redis.getWithVersion$(redisKey))).rejects.toThrow(`Error getting ${redisKey} from redis`);
+        expect(hmget).toHaveBeenCalledWith(redisKey, 'value', 'version');
+    });
+
+    it('getAndTouch$ operation should return value and prolong TTL in one script', async () => {
+        expect.assertions(3);
+
+        const evalsha = jest.fn<() => Promise<unknown>>().mockResolvedValueOnce(redisValue).mockResolvedValueOnce(null);
+        const redis = new NestJSRxJSRedisService(getRedisService({ evalsha } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.getAndTouch$(redisKey, redisTTLValue))).resolves.toBe(redisValue);
+        await expect(lastValueFrom(redis.getAndTouch$(redisKey, redisTTLValue))).rejects.toThrow(
+            `Error getting ${redisKey} from redis`
+        );
+        expect(evalsha).toHaveBeenCalledWith(getAndTouchScript.sha, 1, redisKey, redisTTLValue);
+    });
+
+    it('xreadGroup$ operation should handle stream entries on a dedicated connection', async () => {
+        expect.assertions(2);
+
+        const exec = jest
+            .fn<() => Promise<PipelineReplies>>()
+            .mockResolvedValue([[null, [['stream', [['1-0', ['a', '1']]]]]]]);
+        const consumerClient = {
+            disconnect: jest.fn(),
+            pipeline: jest.fn().mockReturnValue({ exec }),
+            xgroup: jest.fn<() => Promise<string>>().mockResolvedValue('OK'),
+        };
+        const duplicate = jest.fn().mockReturnValue(consumerClient);
+        const redis = new NestJSRxJSRedisService(getRedisService({ duplicate } as unknown as RedisClient));
+
+        await expect(
+            lastValueFrom(redis.xreadGroup$('stream', 'group', 'consumer', entry => of(entry)).pipe(take(1)))
+        ).resolves.toStrictEqual({ id: '1-0', fields: { a: '1' } });
+        expect(duplicate).toHaveBeenCalledTimes(1);
+    });
+
     it('save operator', done => {
         expect.assertions(3);
 
@@ -358,6 +752,246 @@ describe('NestJSRxJSRedisService', () => {
             });
     });
 
+    it.each([
+        [false, concurrentRequests],
+        [true, 1],
+    ])('cache operator with cacheSingleflight=%s calls prepareFn$ %s time(s) on misses', async (singleflight, calls) => {
+        expect.assertions(2);
+
+        const get = jest.fn<Redis['get']>().mockRejectedValue('');
+        const redis = new NestJSRxJSRedisService(getRedisService({ get }), { cacheSingleflight: singleflight });
+        const prepareFn$ = jest.fn(() => of(redisValue));
+
+        const results = await Promise.all(
+            Array.from({ length: concurrentRequests }, () => lastValueFrom(of(redisKey).pipe(redis.cache(1, prepareFn$))))
+        );
+
+        expect(prepareFn$).toHaveBeenCalledTimes(calls);
+        expect(results).toStrictEqual(Array.from({ length: concurrentRequests }, () => redisValue));
+    });
+
+    it('cache operators should not share flights of the same key with cacheSingleflight option', async () => {
+        expect.assertions(2);
+
+        const get = jest.fn<Redis['get']>().mockRejectedValue('');
+        const redis = new NestJSRxJSRedisService(getRedisService({ get }), { cacheSingleflight: true });
+        const prepareFn$ = jest.fn(() => of(redisValue));
+
+        const results = await Promise.all([
+            lastValueFrom(of(redisKey).pipe(redis.cache(1, prepareFn$))),
+            lastValueFrom(of(redisKey).pipe(redis.swrCache(1, 1, prepareFn$))),
+        ]);
+
+        expect(prepareFn$).toHaveBeenCalledTimes(2);
+        expect(results).toStrictEqual([redisValue, redisValue]);
+    });
+
+    it('cache operator should prepare value and release acquired lease with cacheLease option', async () => {
+        expect.assertions(5);
+
+        const get = jest.fn<Redis['get']>().mockRejectedValue('');
+        const set = jest.fn<Redis['set']>().mockResolvedValue('OK');
+        const del = jest.fn<Redis['del']>().mockResolvedValue(1);
+        const evalsha = jest.fn<() => Promise<unknown>>().mockResolvedValue(1);
+        const redis = new NestJSRxJSRedisService(getRedisService({ del, evalsha, get, set } as unknown as RedisClient), {
+            cacheLease: true,
+        });
+
+        const data = await lastValueFrom(of(redisKey).pipe(redis.cache(1, () => of(redisValue))));
+        const leaseToken = set.mock.calls[0][1];
+
+        expect(data).toBe(redisValue);
+        expect(set).toHaveBeenCalledWith(
+            `${redisKey}:lease`,
+            expect.stringMatching(/^[\da-f]{32}$/u),
+            'PX',
+            defaultNestJSRxJSRedisModuleOptions.cacheLeaseTtlInMs,
+            'NX'
+        );
+        expect(set).toHaveBeenCalledWith(redisKey, JSON.stringify(redisValue), 'EX', 1);
+        // HINT: Lease is released by compare-and-delete script, so only its holder can delete it
+        expect(evalsha).toHaveBeenCalledWith(releaseLeaseScript.sha, 1, `${redisKey}:lease`, leaseToken);
+        expect(del).not.toHaveBeenCalled();
+    });
+
+    it('cache operator should wait for value prepared by lease holder with cacheLease option', async () => {
+        expect.assertions(2);
+
+        const get = jest
+            .fn<Redis['get']>()
+            .mockRejectedValueOnce('')
+            .mockResolvedValueOnce(null)
+            .mockResolvedValue(JSON.stringify(redisValue));
+        const set = jest.fn<Redis['set']>().mockResolvedValue(null);
+        const redis = new NestJSRxJSRedisService(getRedisService({ get, set } as unknown as RedisClient), {
+            cacheLease: true,
+            cacheLeaseRetryDelayInMs: 1,
+        });
+        const prepareFn$ = jest.fn(() => of(redisValue));
+
+        const data = await lastValueFrom(of(redisKey).pipe(redis.cache(1, prepareFn$)));
+
+        expect(data).toBe(redisValue);
+        expect(prepareFn$).not.toHaveBeenCalled();
+    });
+
+    it('cache operator should prepare value if lease holder has not saved it in time with cacheLease option', async () => {
+        expect.assertions(2);
+
+        const get = jest.fn<Redis['get']>().mockResolvedValue(null);
+        const set = jest.fn<Redis['set']>().mockResolvedValue(null);
+        const redis = new NestJSRxJSRedisService(getRedisService({ get, set } as unknown as RedisClient), {
+            cacheLease: true,
+            cacheLeaseRetryDelayInMs: 1,
+            cacheLeaseTtlInMs: 2,
+        });
+        const prepareFn$ = jest.fn(() => of(redisValue));
+
+        await expect(lastValueFrom(of(redisKey).pipe(redis.cache(1, prepareFn$)))).resolves.toBe(redisValue);
+        expect(prepareFn$).toHaveBeenCalledTimes(1);
+    });
+
+    it('swrCache operator should return fresh value without prepareFn$', async () => {
+        expect.assertions(2);
+
+        const get = jest.fn<Redis['get']>().mockResolvedValue(getStaleCacheEntry(redisTTLValue * 1000));
+        const redis = new NestJSRxJSRedisService(getRedisService({ get }));
+        const prepareFn$ = jest.fn(() => of('newValue'));
+
+        const data = await lastValueFrom(of(redisKey).pipe(redis.swrCache(redisTTLValue, staleTTLValue, prepareFn$)));
+
+        expect(data).toBe(redisValue);
+        expect(prepareFn$).not.toHaveBeenCalled();
+    });
+
+    it('swrCache operator should return stale value and refresh it in background', async () => {
+        expect.assertions(3);
+
+        const get = jest.fn<Redis['get']>().mockResolvedValue(getStaleCacheEntry(-1));
+        const set = jest.fn<Redis['set']>().mockResolvedValue('OK');
+        const redis = new NestJSRxJSRedisService(getRedisService({ get, set } as unknown as RedisClient));
+        const prepareFn$ = jest.fn(() => of('newValue'));
+
+        const data = await lastValueFrom(of(redisKey).pipe(redis.swrCache(redisTTLValue, staleTTLValue, prepareFn$)));
+
+        expect(data).toBe(redisValue);
+        expect(prepareFn$).toHaveBeenCalledTimes(1);
+        expect(set).toHaveBeenCalledWith(
+            redisKey,
+            expect.stringMatching(/^\d+:\d+:"newValue"$/u),
+            'EX',
+            redisTTLValue + staleTTLValue
+        );
+    });
+
+    it('swrCache operator should start one background refresh for concurrent stale reads', async () => {
+        expect.assertions(2);
+
+        const get = jest.fn<Redis['get']>().mockResolvedValue(getStaleCacheEntry(-1));
+        const redis = new NestJSRxJSRedisService(getRedisService({ get }));
+        const refresh$ = new Subject<string>();
+        const prepareFn$ = jest.fn(() => refresh$);
+
+        const results = await Promise.all(
+            Array.from({ length: concurrentRequests }, () =>
+                lastValueFrom(of(redisKey).pipe(redis.swrCache(redisTTLValue, staleTTLValue, prepareFn$)))
+            )
+        );
+        refresh$.complete();
+
+        expect(prepareFn$).toHaveBeenCalledTimes(1);
+        expect(results).toStrictEqual(Array.from({ length: concurrentRequests }, () => redisValue));
+    });
+
+    it('swrCache operator should log background refresh errors', async () => {
+        expect.assertions(2);
+
+        const warn = jest.spyOn(Logger.prototype, 'warn').mockImplementation(emptyFn);
+        const get = jest.fn<Redis['get']>().mockResolvedValue(getStaleCacheEntry(-1));
+        const redis = new NestJSRxJSRedisService(getRedisService({ get }));
+
+        const data = await lastValueFrom(
+            of(redisKey).pipe(redis.swrCache(redisTTLValue, staleTTLValue, () => throwError(() => new Error('FAIL'))))
+        );
+
+        expect(data).toBe(redisValue);
+        expect(warn).toHaveBeenCalledWith(`Error refreshing stale ${redisKey} cache value: FAIL`);
+
+        warn.mockRestore();
+    });
+
+    it('swrCache operator should prepare missing or invalid value', async () => {
+        expect.assertions(2);
+
+        const get = jest.fn<Redis['get']>().mockResolvedValue(JSON.stringify(redisValue));
+        const set = jest.fn<Redis['set']>().mockResolvedValue('OK');
+        const redis = new NestJSRxJSRedisService(getRedisService({ get, set } as unknown as RedisClient));
+
+        const data = await lastValueFrom(
+            of(redisKey).pipe(redis.swrCache(redisTTLValue, staleTTLValue, () => of('newValue')))
+        );
+
+        expect(data).toBe('newValue');
+        expect(set).toHaveBeenCalledTimes(1);
+    });
+
+    it('setBuffer$ and getBuffer$ should work with binary values', async () => {
+        expect.assertions(3);
+
+        const buffer = Buffer.from(redisValue);
+        const set = jest.fn<Redis['set']>().mockResolvedValue('OK');
+        const getBuffer = jest.fn<Redis['getBuffer']>().mockResolvedValue(buffer);
+        const redis = new NestJSRxJSRedisService(getRedisService({ getBuffer, set } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.setBuffer$(redisKey, buffer, redisTTLValue))).resolves.toBe(true);
+        await expect(lastValueFrom(redis.getBuffer$(redisKey))).resolves.toBe(buffer);
+        expect(set).toHaveBeenCalledWith(redisKey, buffer, 'EX', redisTTLValue);
+    });
+
+    it('setBuffer$ and getBuffer$ should throw errors', async () => {
+        expect.assertions(2);
+
+        const set = jest.fn<Redis['set']>().mockRejectedValue('FAIL');
+        const getBuffer = jest.fn<Redis['getBuffer']>().mockResolvedValue(null);
+        const redis = new NestJSRxJSRedisService(getRedisService({ getBuffer, set } as unknown as RedisClient));
+
+        await expect(lastValueFrom(redis.setBuffer$(redisKey, Buffer.from(redisValue), 1))).rejects.toThrow(
+            `Error setting ${redisKey} to redis`
+        );
+        await expect(lastValueFrom(redis.getBuffer$(redisKey))).rejects.toThrow(`Error getting ${redisKey} from redis`);
+    });
+
+    it('saveEncoded and loadEncoded operators should use codec', async () => {
+        expect.assertions(3);
+
+        const codec = createJsonCodec<{ id: string }>();
+        const value = { id: redisValue };
+        const set = jest.fn<Redis['set']>().mockResolvedValue('OK');
+        const getBuffer = jest.fn<Redis['getBuffer']>().mockResolvedValue(codec.encode(value));
+        const redis = new NestJSRxJSRedisService(getRedisService({ getBuffer, set } as unknown as RedisClient));
+
+        await expect(lastValueFrom(of(value).pipe(redis.saveEncoded(() => redisKey, 1, codec)))).resolves.toBe(value);
+        await expect(lastValueFrom(of(redisKey).pipe(redis.loadEncoded(codec)))).resolves.toStrictEqual(value);
+        expect(set).toHaveBeenCalledWith(redisKey, codec.encode(value), 'EX', 1);
+    });
+
+    it('cacheEncoded operator should load existing value or prepare and save it', async () => {
+        expect.assertions(3);
+
+        const codec = createJsonCodec<string>();
+        const set = jest.fn<Redis['set']>().mockResolvedValue('OK');
+        const getBuffer = jest
+            .fn<Redis['getBuffer']>()
+            .mockResolvedValueOnce(codec.encode(redisValue))
+            .mockResolvedValueOnce(null);
+        const redis = new NestJSRxJSRedisService(getRedisService({ getBuffer, set } as unknown as RedisClient));
+        const cache$ = of(redisKey).pipe(redis.cacheEncoded(1, () => of('newValue'), codec));
+
+        await expect(lastValueFrom(cache$)).resolves.toBe(redisValue);
+        await expect(lastValueFrom(cache$)).resolves.toBe('newValue');
+        expect(set).toHaveBeenCalledWith(redisKey, codec.encode('newValue'), 'EX', 1);
+    });
+
     it('increment value in redis', done => {
         expect.assertions(2);
 
@@ -451,4 +1085,103 @@ describe('NestJSRxJSRedisService', () => {
             },
         });
     });
+
+    it('should send get$/set$/del$/incr$ through one pipeline with autoBatch option', async () => {
+        expect.assertions(4);
+
+        const exec = jest.fn().mockResolvedValue([
+            [null, redisValue],
+            [null, 'OK'],
+            [null, 1],
+            [null, 2],
+        ]);
+        const pipeline = jest.fn().mockReturnValue({ exec });
+        const redisService = { ...getRedisService(), pipeline } as unknown as Redis;
+        const redis = new NestJSRxJSRedisService(redisService, { autoBatch: true });
+
+        const results = await Promise.all([
+            lastValueFrom(redis.get$(redisKey)),
+            lastValueFrom(redis.set$(redisKey, redisValue, redisTTLValue)),
+            lastValueFrom(redis.del$(redisKey)),
+            lastValueFrom(redis.incr$(redisKey)),
+        ]);
+
+        expect(pipeline).toHaveBeenCalledWith([
+            ['get', redisKey],
+            ['set', redisKey, redisValue, 'EX', redisTTLValue],
+            ['del', redisKey],
+            ['incr', redisKey],
+        ]);
+        expect(redisService.get).not.toHaveBeenCalled();
+        expect(results).toStrictEqual([redisValue, true, 1, 2]);
+        expect(redis.getAutoBatchStats()).toMatchObject({ batches: 1, commands: 4, maxBatchSize: 4 });
+    });
+
+    it('should send setBuffer$/getBuffer$ through one pipeline with autoBatch option', async () => {
+        expect.assertions(3);
+
+        const buffer = Buffer.from(redisValue);
+        const exec = jest.fn().mockResolvedValue([
+            [null, 'OK'],
+            [null, buffer],
+        ]);
+        const pipeline = jest.fn().mockReturnValue({ exec });
+        const redisService = { ...getRedisService(), pipeline } as unknown as Redis;
+        const redis = new NestJSRxJSRedisService(redisService, { autoBatch: true });
+
+        const results = await Promise.all([
+            lastValueFrom(redis.setBuffer$(redisKey, buffer, redisTTLValue)),
+            lastValueFrom(redis.getBuffer$(redisKey)),
+        ]);
+
+        expect(pipeline).toHaveBeenCalledWith([
+            ['set', redisKey, buffer, 'EX', redisTTLValue],
+            ['getBuffer', redisKey],
+        ]);
+        expect(redisService.getBuffer).not.toHaveBeenCalled();
+        expect(results).toStrictEqual([true, buffer]);
+    });
+
+    it('should serve get$ from L1 cache with l1Cache option until key is invalidated', async () => {
+        expect.assertions(4);
+
+        const subscriber = Object.assign(new EventEmitter(), {
+            call: jest.fn<() => Promise<unknown>>().mockResolvedValue(1),
+            disconnect: jest.fn(),
+            subscribe: jest.fn<() => Promise<unknown>>().mockResolvedValue(1),
+        });
+        const redisService = Object.assign(new EventEmitter(), getRedisService(), {
+            call: jest.fn<() => Promise<unknown>>().mockResolvedValue('OK'),
+            duplicate: jest.fn().mockReturnValue(subscriber),
+        }) as unknown as Redis;
+        const redis = new NestJSRxJSRedisService(redisService, { l1Cache: true });
+
+        subscriber.emit('ready');
+        await new Promise(resolve => void setImmediate(resolve));
+
+        await expect(lastValueFrom(redis.get$(redisKey))).resolves.toBe(redisValue);
+        await expect(lastValueFrom(redis.get$(redisKey))).resolves.toBe(redisValue);
+
+        await lastValueFrom(redis.set$(redisKey, redisValue, redisTTLValue));
+        await lastValueFrom(redis.get$(redisKey));
+        redis.onModuleDestroy();
+
+        expect(redisService.get).toHaveBeenCalledTimes(2);
+        expect(redis.getL1CacheStats()).toMatchObject({ hits: 1, misses: 2, invalidations: 1 });
+    });
+
+    it('should not have L1 cache stats without l1Cache option', () => {
+        expect.assertions(1);
+
+        const redis = new NestJSRxJSRedisService(getRedisService());
+        redis.onModuleDestroy();
+
+        expect(redis.getL1CacheStats()).toBeUndefined();
+    });
+
+    it('should not have auto batch stats without autoBatch option', () => {
+        expect.assertions(1);
+
+        expect(new NestJSRxJSRedisService(getRedisService()).getAutoBatchStats()).toBeUndefined();
+    });
 });
@@ -1,15 +1,137 @@
-import { Injectable } from '@nestjs/common';
+/* eslint-disable max-lines */
+import { Inject, Injectable, Logger, Optional } from '@nestjs/common';
 import { InjectRedis } from '@nestjs-modules/ioredis';
-import { Redis } from 'ioredis';
-import { catchError, concatMap, from, map, of, throwError } from 'rxjs';
+import { randomBytes } from 'crypto';
 
-import { isDefined } from '@rnw-community/shared';
+import { type Cluster, Redis } from 'ioredis';
+import {
+    EMPTY,
+    catchError,
+    concatMap,
+    defaultIfEmpty,
+    defer,
+    expand,
+    finalize,
+    forkJoin,
+    from,
+    map,
+    mergeMap,
+    of,
+    reduce,
+    retry,
+    tap,
+    throwError,
+    toArray,
+} from 'rxjs';
 
+import { emptyFn, getErrorMessage, isDefined } from '@rnw-community/shared';
+
+import { groupByClusterNode, groupByClusterSlot } from '../cluster/group-by-cluster.util';
+import { L1Cache } from '../l1-cache/l1-cache';
+import { L1CacheInvalidator } from '../l1-cache/l1-cache-invalidator';
+import {
+    NESTJS_RXJS_REDIS_MODULE_OPTIONS,
+    type NestJSRxJSRedisModuleOptions,
+    defaultNestJSRxJSRedisModuleOptions,
+} from '../nestjs-rxjs-redis-module.options';
+import { RedisCommandBatcher } from '../redis-command-batcher/redis-command-batcher';
+import {
+    getAndTouchScript,
+    incrWithTtlScript,
+    releaseLeaseScript,
+    setIfVersionScript,
+} from '../redis-script/redis-scripts';
+import { RedisStreamConsumer } from '../redis-stream-consumer/redis-stream-consumer';
+import { Singleflight } from '../singleflight/singleflight';
+import { chunkArray } from '../util/chunk-array.util';
+import { createReplicaClient } from '../util/create-replica-client.util';
+import {
+    parseStaleCacheEntry,
+    serializeStaleCacheEntry,
+    shouldRefreshStaleCacheEntry,
+} from '../util/stale-cache-entry.util';
+import { toPairs } from '../util/to-pairs.util';
+import { zipKeysValues } from '../util/zip-keys-values.util';
+
+import type { RedisAutoBatchStatsInterface } from '../interface/redis-auto-batch-stats.interface';
+import type { RedisCodecInterface } from '../interface/redis-codec.interface';
+import type { RedisL1CacheStatsInterface } from '../interface/redis-l1-cache-stats.interface';
+import type { RedisMsetEntryInterface } from '../interface/redis-mset-entry.interface';
+import type { RedisStreamConsumerOptionsInterface } from '../interface/redis-stream-consumer-options.interface';
+import type { RedisStreamEntryInterface } from '../interface/redis-stream-entry.interface';
+import type { RedisVersionedValueInterface } from '../interface/redis-versioned-value.interface';
+import type { StaleCacheEntryInterface } from '../interface/stale-cache-entry.interface';
+import type { RedisCommand } from '../redis-command-batcher/redis-command-batcher';
+import type { RedisScript, RedisScriptArg } from '../redis-script/redis-script';
+import type { OnModuleDestroy } from '@nestjs/common';
 import type { MonoTypeOperatorFunction, Observable, OperatorFunction } from 'rxjs';
 
+type ScanFn = (cursor: string) => Promise<[cursor: string, elements: string[]]>;
+type CacheOperator = 'cache' | 'cacheEncoded' | 'swrCache';
+
+const DEFAULT_SCAN_COUNT = 100;
+const DEFAULT_DELETE_CHUNK_SIZE = 100;
+const LEASE_TOKEN_BYTES = 16;
+
 @Injectable()
-export class NestJSRxJSRedisService {
-    constructor(@InjectRedis() private readonly redisClient: Redis) {}
+export class NestJSRxJSRedisService implements OnModuleDestroy {
+    private readonly options: NestJSRxJSRedisModuleOptions;
+    private readonly batcher?: RedisCommandBatcher;
+    private readonly singleflight = new Singleflight();
+    // HINT: Background swrCache refreshes are always deduplicated, regardless of `cacheSingleflight` option
+    private readonly refreshes = new Singleflight();
+    private readonly logger = new Logger(NestJSRxJSRedisService.name);
+    private readonly l1Cache?: L1Cache;
+    private readonly l1CacheInvalidator?: L1CacheInvalidator;
+    private readonly readClient: Redis;
+
+    constructor(
+        @InjectRedis() private readonly redisClient: Redis,
+        @Optional() @Inject(NESTJS_RXJS_REDIS_MODULE_OPTIONS) options: Partial<NestJSRxJSRedisModuleOptions> = {}
+    ) {
+        this.options = { ...defaultNestJSRxJSRedisModuleOptions, ...options };
+        this.readClient = this.options.readFromReplica ? createReplicaClient(redisClient) : redisClient;
+
+        // HINT: Cluster pipelines and client tracking are bound to one node, use cluster `enableAutoPipelining` instead
+        if (this.options.autoBatch && !redisClient.isCluster) {
+            this.batcher = new RedisCommandBatcher(
+                redisClient,
+                this.options.autoBatchWindowInMs,
+                this.options.autoBatchMaxSize
+            );
+        }
+
+        if (this.options.l1Cache && !redisClient.isCluster) {
+            this.l1Cache = new L1Cache(this.options.l1CacheMaxBytes);
+            this.l1CacheInvalidator = new L1CacheInvalidator(this.readClient, this.l1Cache);
+        }
+    }
+
+    onModuleDestroy(): void {
+        this.l1CacheInvalidator?.close();
+
+        if (this.readClient !== this.redisClient) {
+            this.readClient.disconnect();
+        }
+    }
+
+    /**
+     * Auto batching statistics, available only if `autoBatch` module option is enabled.
+     *
+     * @returns RedisAutoBatchStatsInterface | undefined Sent pipelines count, sizes and flush latencies
+     */
+    getAutoBatchStats(): RedisAutoBatchStatsInterface | undefined {
+        return this.batcher?.getStats();
+    }
+
+    /**
+     * L1 cache statistics, available only if `l1Cache` module option is enabled.
+     *
+     * @returns RedisL1CacheStatsInterface | undefined L1 cache hits, misses, evictions, invalidations and size
+     */
+    getL1CacheStats(): RedisL1CacheStatsInterface | undefined {
+        return this.l1Cache?.getStats();
+    }
 
     /**
      * RxJS wrapper for redis set operation.
@@ -23,7 +145,16 @@ export class NestJSRxJSRedisService {
      * @returns Observable<boolean> with operation success status
      */
     set$(key: string, value: string, ttlInSeconds: number, error = `Error setting ${key} to redis`): Observable<boolean> {
-        return from(this.redisClient.set(key, value, 'EX', ttlInSeconds)).pipe(
+        this.l1Cache?.invalidate([key]);
+
+        return this.command$(
+            () => this.redisClient.set(key, value, 'EX', ttlInSeconds),
+            'set',
+            key,
+            value,
+            'EX',
+            ttlInSeconds
+        ).pipe(
             map(() => true),
             catchError(() => throwError(() => new Error(error)))
         );
@@ -32,6 +163,9 @@ export class NestJSRxJSRedisService {
     /**
      * RxJS wrapper for redis get operation.
      *
+     * With `l1Cache` module option value is returned from the in-process cache when available,
+     * with `readFromReplica` module option value is read from replica.
+     *
      * @see https://redis.io/commands/get
      *
      * @param key Redis key
@@ -39,7 +173,64 @@ export class NestJSRxJSRedisService {
      * @returns Observable<string> Value from redis
      */
     get$(key: string, error = `Error getting ${key} from redis`): Observable<string> {
-        return from(this.redisClient.get(key)).pipe(
+        const l1Value = this.l1Cache?.get(key);
+
+        if (isDefined(l1Value)) {
+            return of(l1Value);
+        }
+
+        const l1Version = this.l1Cache?.getVersion(key) ?? 0;
+
+        return this.read$(client => client.get(key), 'get', key).pipe(
+            concatMap(res => (isDefined(res) ? of(res) : throwError(() => new Error(error)))),
+            tap(res => void this.l1Cache?.set(key, res, l1Version)),
+            catchError(() => throwError(() => new Error(error)))
+        );
+    }
+
+    /**
+     * RxJS wrapper for redis set operation with binary value.
+     *
+     * @see https://redis.io/commands/set
+     *
+     * @param key Redis key
+     * @param value Buffer for setting
+     * @param ttlInSeconds Time to live in seconds
+     * @param error Error string
+     * @returns Observable<boolean> with operation success status
+     */
+    setBuffer$(
+        key: string,
+        value: Buffer,
+        ttlInSeconds: number,
+        error = `Error setting ${key} to redis`
+    ): Observable<boolean> {
+        this.l1Cache?.invalidate([key]);
+
+        return this.command$(
+            () => this.redisClient.set(key, value, 'EX', ttlInSeconds),
+            'set',
+            key,
+            value,
+            'EX',
+            ttlInSeconds
+        ).pipe(
+            map(() => true),
+            catchError(() => throwError(() => new Error(error)))
+        );
+    }
+
+    /**
+     * RxJS wrapper for redis get operation returning binary value, L1 cache is not used.
+     *
+     * @see https://redis.io/commands/get
+     *
+     * @param key Redis key
+     * @param error Error string
+     * @returns Observable<Buffer> Value from redis
+     */
+    getBuffer$(key: string, error = `Error getting ${key} from redis`): Observable<Buffer> {
+        return this.read$(client => client.getBuffer(key), 'getBuffer', key).pipe(
             concatMap(res => (isDefined(res) ? of(res) : throwError(() => new Error(error)))),
             catchError(() => throwError(() => new Error(error)))
         );
@@ -56,7 +247,11 @@ export class NestJSRxJSRedisService {
      * @returns Observable<number> Number of keys deleted from redis
      */
     del$(key: string, error = `Error deleting ${key} from redis`): Observable<number> {
-        return from(this.redisClient.del(key)).pipe(catchError(() => throwError(() => new Error(error))));
+        this.l1Cache?.invalidate([key]);
+
+        return this.command$(() => this.redisClient.del(key), 'del', key).pipe(
+            catchError(() => throwError(() => new Error(error)))
+        );
     }
 
     /**
@@ -96,7 +291,103 @@ export class NestJSRxJSRedisService {
      * @returns Observable<number> increased value
      */
     incr$(key: string, error = `Error increment ${key} from redis`): Observable<number> {
-        return from(this.redisClient.incr(key)).pipe(catchError(() => throwError(() => new Error(error))));
+        return this.command$(() => this.redisClient.incr(key), 'incr', key).pipe(
+            catchError(() => throwError(() => new Error(error)))
+        );
+    }
+
+    /**
+     * Execute Lua script in one round trip, using EVALSHA and sending script body only if redis has not cached it.
+     *
+     * @see https://redis.io/commands/evalsha
+     *
+     * @param script Lua script
+     * @param keys Redis keys used by the script
+     * @param args Script arguments
+     * @param error Error string
+     * @returns Observable<T> Script result
+     */
+    script$<T>(
+        script: RedisScript<T>,
+        keys: string[],
+        args: RedisScriptArg[] = [],
+        error = `Error executing script ${script.sha} in redis`
+    ): Observable<T> {
+        return from(script.exec(this.redisClient, keys, args)).pipe(catchError(() => throwError(() => new Error(error))));
+    }
+
+    /**
+     * Atomic increment which sets key TTL when the key is created, replaces `incr$` followed by `expire$`.
+     *
+     * @see script$
+     *
+     * @param key Redis key
+     * @param ttlInSeconds Time to live in seconds
+     * @param error Error string
+     * @returns Observable<number> increased value
+     */
+    incrWithTtl$(key: string, ttlInSeconds: number, error = `Error increment ${key} from redis`): Observable<number> {
+        this.l1Cache?.invalidate([key]);
+
+        return this.script$(incrWithTtlScript, [key], [ttlInSeconds], error);
+    }
+
+    /**
+     * Atomic compare-and-set of the hash `value` field, value is set only if current `version` field
+     * equals `expectedVersion`(0 for missing key), version is increased by every successful set.
+     *
+     * @see script$
+     * @see getWithVersion$
+     *
+     * @param key Redis hash key
+     * @param value Value for setting
+     * @param expectedVersion Version the value was read with
+     * @param ttlInSeconds Time to live in seconds
+     * @returns Observable<number | null> New version, or null if value was changed by someone else
+     */
+    setIfVersion$(key: string, value: string, expectedVersion: number, ttlInSeconds: number): Observable<number | null> {
+        this.l1Cache?.invalidate([key]);
+
+        return this.script$(
+            setIfVersionScript,
+            [key],
+            [value, expectedVersion, ttlInSeconds],
+            `Error setting ${key} to redis`
+        ).pipe(map(version => (version < 0 ? null : version)));
+    }
+
+    /**
+     * Get value stored by `setIfVersion$` with its version.
+     *
+     * @see https://redis.io/commands/hmget
+     *
+     * @param key Redis hash key
+     * @param error Error string
+     * @returns Observable<RedisVersionedValueInterface> Value and its version
+     */
+    getWithVersion$(key: string, error = `Error getting ${key} from redis`): Observable<RedisVersionedValueInterface> {
+        return from(this.readClient.hmget(key, 'value', 'version')).pipe(
+            concatMap(([value, version]) =>
+                isDefined(value) ? of({ value, version: Number(version) }) : throwError(() => new Error(error))
+            ),
+            catchError(() => throwError(() => new Error(error)))
+        );
+    }
+
+    /**
+     * Get value and prolong its TTL in one round trip.
+     *
+     * @see script$
+     *
+     * @param key Redis key
+     * @param ttlInSeconds New time to live in seconds
+     * @param error Error string
+     * @returns Observable<string> Value from redis
+     */
+    getAndTouch$(key: string, ttlInSeconds: number, error = `Error getting ${key} from redis`): Observable<string> {
+        return this.script$(getAndTouchScript, [key], [ttlInSeconds], error).pipe(
+            concatMap(value => (isDefined(value) ? of(value) : throwError(() => new Error(error))))
+        );
     }
 
     /**
@@ -104,17 +395,240 @@ export class NestJSRxJSRedisService {
      *
      * @see https://redis.io/commands/mget
      *
+     * In cluster mode keys are grouped by node, keys of every node are requested by MGET per hash slot in one pipeline,
+     * nodes are requested in parallel.
+     *
      * @param keys Array of keys
      * @returns Observable<Record<K, string|null>> Object with key:value
      */
     mget$<K extends string>(keys: K[]): Observable<Record<K, string | null>> {
-        return from(this.redisClient.mget(keys)).pipe(
-            map(results =>
-                results.reduce<Record<string, string | null>>((prev, cur, idx) => ({ ...prev, [keys[idx]]: cur }), {})
-            )
+        return this.redisClient.isCluster
+            ? this.clusterMget$(keys)
+            : from(this.readClient.mget(keys)).pipe(map(results => zipKeysValues(keys, results)));
+    }
+
+    /**
+     * RxJS wrapper for redis mget operation for huge key lists, keys are split into chunks
+     * and each chunk result is emitted as soon as it is received.
+     *
+     * @see mget$
+     *
+     * @param keys Array of keys
+     * @param chunkSize Maximal number of keys in one MGET command, positive integer
+     * @param concurrency Maximal number of MGET commands running in parallel
+     * @returns Observable<Record<K, string|null>> Object with key:value for each chunk
+     */
+    mgetChunked$<K extends string>(keys: K[], chunkSize = 1000, concurrency = 1): Observable<Record<K, string | null>> {
+        return defer(() => from(chunkArray(keys, chunkSize))).pipe(mergeMap(chunk => this.mget$(chunk), concurrency));
+    }
+
+    /**
+     * Set multiple keys with individual TTLs in one pipeline, in cluster mode one pipeline per node is sent in parallel.
+     *
+     * @see https://redis.io/commands/set
+     *
+     * @param entries Keys, values and TTLs for setting
+     * @param error Error string
+     * @returns Observable<boolean> with operation success status, fails if any key was not set
+     */
+    mset$(entries: RedisMsetEntryInterface[], error = `Error setting ${entries.length} keys to redis`): Observable<boolean> {
+        this.l1Cache?.invalidate(entries.map(({ key }) => key));
+
+        const groups = this.redisClient.isCluster
+            ? groupByClusterNode(this.redisClient as unknown as Cluster, entries, ({ key }) => key)
+            : [entries];
+        const pipelines = groups.map(group =>
+            this.redisClient
+                .pipeline(group.map(({ key, value, ttlInSeconds }) => ['set', key, value, 'EX', ttlInSeconds]))
+                .exec()
+        );
+
+        return forkJoin(pipelines).pipe(
+            defaultIfEmpty([]),
+            concatMap(results =>
+                results.every(replies => isDefined(replies) && replies.every(([replyError]) => !isDefined(replyError)))
+                    ? of(true)
+                    : throwError(() => new Error(error))
+            ),
+            catchError(() => throwError(() => new Error(error)))
+        );
+    }
+
+    /**
+     * Iterate keys matching the pattern using redis scan operation, emitting a batch of keys for every SCAN reply.
+     *
+     * Observable is cold, next SCAN is sent only after the previous batch was synchronously handled by the subscriber,
+     * use `scanEach$` for asynchronous batch processing. In cluster mode master nodes are scanned one by one.
+     *
+     * @see https://redis.io/commands/scan
+     *
+     * @param pattern Keys glob-style pattern
+     * @param count Amount of work redis does for one SCAN call, approximate batch size
+     * @returns Observable<string[]> Batches of keys, keys can be emitted more than once
+     */
+    scan$(pattern: string, count = DEFAULT_SCAN_COUNT): Observable<string[]> {
+        return this.scanEach$(pattern, keys => of(keys), count);
+    }
+
+    /**
+     * Iterate keys matching the pattern using redis scan operation, next SCAN is sent only after
+     * `batchFn$` observable of the previous batch completes.
+     *
+     * @see scan$
+     *
+     * @param pattern Keys glob-style pattern
+     * @param batchFn$ Handler for processing the batch of keys
+     * @param count Amount of work redis does for one SCAN call, approximate batch size
+     * @returns Observable<R> Values emitted by batchFn$
+     */
+    scanEach$<R>(
+        pattern: string,
+        batchFn$: (keys: string[]) => Observable<R>,
+        count = DEFAULT_SCAN_COUNT
+    ): Observable<R> {
+        const scan$ = (client: Redis): Observable<R> =>
+            this.cursor$(
+                cursor => client.scan(cursor, 'MATCH', pattern, 'COUNT', count),
+                keys => keys,
+                batchFn$,
+                `Error scanning ${pattern} keys in redis`
+            );
+
+        return this.redisClient.isCluster
+            ? from((this.redisClient as unknown as Cluster).nodes('master')).pipe(concatMap(scan$))
+            : scan$(this.redisClient);
+    }
+
+    /**
+     * Iterate hash fields matching the pattern using redis hscan operation.
+     *
+     * @see https://redis.io/commands/hscan
+     * @see scan$
+     *
+     * @param key Redis hash key
+     * @param pattern Fields glob-style pattern
+     * @param count Amount of work redis does for one HSCAN call, approximate batch size
+     * @returns Observable<Array<[field, value]>> Batches of hash fields and values
+     */
+    hscan$(key: string, pattern = '*', count = DEFAULT_SCAN_COUNT): Observable<Array<[field: string, value: string]>> {
+        return this.cursor$(
+            cursor => this.redisClient.hscan(key, cursor, 'MATCH', pattern, 'COUNT', count),
+            elements => toPairs(elements, String),
+            batch => of(batch),
+            `Error scanning ${key} hash fields in redis`
+        );
+    }
+
+    /**
+     * Iterate set members matching the pattern using redis sscan operation.
+     *
+     * @see https://redis.io/commands/sscan
+     * @see scan$
+     *
+     * @param key Redis set key
+     * @param pattern Members glob-style pattern
+     * @param count Amount of work redis does for one SSCAN call, approximate batch size
+     * @returns Observable<string[]> Batches of set members
+     */
+    sscan$(key: string, pattern = '*', count = DEFAULT_SCAN_COUNT): Observable<string[]> {
+        return this.cursor$(
+            cursor => this.redisClient.sscan(key, cursor, 'MATCH', pattern, 'COUNT', count),
+            members => members,
+            batch => of(batch),
+            `Error scanning ${key} set members in redis`
+        );
+    }
+
+    /**
+     * Iterate sorted set members matching the pattern using redis zscan operation.
+     *
+     * @see https://redis.io/commands/zscan
+     * @see scan$
+     *
+     * @param key Redis sorted set key
+     * @param pattern Members glob-style pattern
+     * @param count Amount of work redis does for one ZSCAN call, approximate batch size
+     * @returns Observable<Array<[member, score]>> Batches of sorted set members and scores
+     */
+    zscan$(key: string, pattern = '*', count = DEFAULT_SCAN_COUNT): Observable<Array<[member: string, score: number]>> {
+        return this.cursor$(
+            cursor => this.redisClient.zscan(key, cursor, 'MATCH', pattern, 'COUNT', count),
+            elements => toPairs(elements, Number),
+            batch => of(batch),
+            `Error scanning ${key} sorted set members in redis`
         );
     }
 
+    /**
+     * Delete keys matching the pattern without blocking redis with KEYS command.
+     *
+     * Every SCAN batch is split into chunks(per hash slot in cluster mode) deleted by up to `concurrency`
+     * parallel UNLINK(or DEL) commands, next SCAN is sent only after the whole batch is deleted.
+     *
+     * @see scanEach$
+     *
+     * @param pattern Keys glob-style pattern
+     * @param count Amount of work redis does for one SCAN call, approximate batch size
+     * @param chunkSize Maximal number of keys in one UNLINK/DEL command
+     * @param concurrency Maximal number of UNLINK/DEL commands running in parallel
+     * @param unlink Use non-blocking UNLINK instead of DEL
+     * @returns Observable<number> Total number of deleted keys
+     */
+    // eslint-disable-next-line @typescript-eslint/max-params
+    deleteByPattern$(
+        pattern: string,
+        count = DEFAULT_SCAN_COUNT,
+        chunkSize = DEFAULT_DELETE_CHUNK_SIZE,
+        concurrency = 4,
+        unlink = true
+    ): Observable<number> {
+        const delete$ = (keys: string[]): Observable<number> => {
+            this.l1Cache?.invalidate(keys);
+
+            return from(unlink ? this.redisClient.unlink(keys) : this.redisClient.del(keys));
+        };
+
+        const chunks = (keys: string[]): string[][] =>
+            this.redisClient.isCluster
+                ? groupByClusterSlot(keys, key => key).flatMap(slotKeys => chunkArray(slotKeys, chunkSize))
+                : chunkArray(keys, chunkSize);
+
+        return this.scanEach$(pattern, keys => from(chunks(keys)).pipe(mergeMap(delete$, concurrency)), count).pipe(
+            reduce((total, deleted) => total + deleted, 0),
+            catchError(() => throwError(() => new Error(`Error deleting ${pattern} keys from redis`)))
+        );
+    }
+
+    /**
+     * Long-lived redis stream consumer group reader, emits handler results until unsubscribed.
+     *
+     * Stream is read on a dedicated connection by batches of up to `count` entries, every batch is handled with up to
+     * `concurrency` parallel handlers and the next batch is read only after the current one is handled. Results are
+     * emitted per entry, entries of completed handlers are acknowledged by one XACK pipelined with the next read,
+     * failed entries stay pending and are recovered by XAUTOCLAIM unless `claimMinIdleInMs` is 0.
+     * Consumer group is created if it does not exist.
+     *
+     * @see https://redis.io/commands/xreadgroup
+     * @see https://redis.io/commands/xautoclaim
+     *
+     * @param stream Redis stream key
+     * @param group Consumer group name
+     * @param consumer Consumer name, unique within the group
+     * @param handler$ Entry handler, entry is acknowledged when handler completes
+     * @param options Batch size, blocking timeout, concurrency and pending entries recovery options
+     * @returns Observable<R> Handler results
+     */
+    // eslint-disable-next-line @typescript-eslint/max-params
+    xreadGroup$<R>(
+        stream: string,
+        group: string,
+        consumer: string,
+        handler$: (entry: RedisStreamEntryInterface) => Observable<R>,
+        options: Partial<RedisStreamConsumerOptionsInterface> = {}
+    ): Observable<R> {
+        return new RedisStreamConsumer(this.redisClient, stream, group, consumer, options).consume$(handler$);
+    }
+
     /**
      * RxJS operator for saving data into redis.
      *
@@ -183,12 +697,99 @@ export class NestJSRxJSRedisService {
             source$.pipe(concatMap(input => this.del$(keyFn(input), errorFn(input)).pipe(map(() => input))));
     }
 
+    /**
+     * RxJS operator for saving data into redis using codec, value is stored as a Buffer without string conversion.
+     *
+     * @see save
+     * @see setBuffer$
+     *
+     * @param keyFn Handler for generating redis key
+     * @param ttlInSeconds Time to live in seconds
+     * @param codec Codec for encoding value
+     * @param errorFn Handler for generating saving error message
+     */
+    saveEncoded<T>(
+        keyFn: (input: T) => string,
+        ttlInSeconds: number,
+        codec: RedisCodecInterface<T>,
+        errorFn: (input: T) => string = input => `Error saving "${keyFn(input)}" to redis`
+    ): MonoTypeOperatorFunction<T> {
+        return (source$: Observable<T>): Observable<T> =>
+            source$.pipe(
+                concatMap(input =>
+                    this.setBuffer$(keyFn(input), codec.encode(input), ttlInSeconds, errorFn(input)).pipe(map(() => input))
+                )
+            );
+    }
+
+    /**
+     * RxJS operator for loading data from redis using codec.
+     *
+     * @see load
+     * @see getBuffer$
+     *
+     * @param codec Codec for decoding value
+     * @param keyFn Handler for generating redis key
+     * @param errorFn Handler for generating loading error message
+     */
+    loadEncoded<O, I = string>(
+        codec: RedisCodecInterface<O>,
+        keyFn: (input: I) => string = key => String(key),
+        errorFn: (input: I) => string = input => `Error loading "${keyFn(input)}" from redis`
+    ): OperatorFunction<I, O> {
+        return (source$: Observable<I>): Observable<O> =>
+            source$.pipe(
+                concatMap(input => this.getBuffer$(keyFn(input), errorFn(input)).pipe(map(buffer => codec.decode(buffer))))
+            );
+    }
+
+    /**
+     * RxJS operator for common cache operation using codec.
+     *
+     * @see cache
+     *
+     * @param ttlInSeconds Time to live in seconds
+     * @param prepareFn$ Handler for getting/preparing data
+     * @param codec Codec for encoding and decoding value
+     * @param keyFn Redis key generation callback, by default takes input stream and uses emitted value as a key
+     *
+     * @returns OperatorFunction RxJS operator
+     */
+    cacheEncoded<R, T = string>(
+        ttlInSeconds: number,
+        prepareFn$: (input: string) => Observable<R>,
+        codec: RedisCodecInterface<R>,
+        keyFn: (input: T) => string = input => String(input)
+    ): OperatorFunction<T, R> {
+        return (source$: Observable<T>): Observable<R> =>
+            source$.pipe(
+                concatMap(input => {
+                    const key = keyFn(input);
+
+                    const prepare$ = (): Observable<R> =>
+                        prepareFn$(key).pipe(
+                            concatMap(data =>
+                                this.setBuffer$(key, codec.encode(data), ttlInSeconds).pipe(map(() => data))
+                            )
+                        );
+
+                    const load$ = (): Observable<R> => this.getBuffer$(key).pipe(map(buffer => codec.decode(buffer)));
+
+                    return load$().pipe(catchError(() => this.recompute$('cacheEncoded', key, prepare$, load$)));
+                })
+            );
+    }
+
     /**
      * RxJS operator for common cache operation.
      *
      * This operator loads data from redis and if data is not available
      * executes prepareFn$ handler and saves returned data to redis.
      *
+     * With `cacheSingleflight` module option concurrent misses of the same key share one prepareFn$ execution,
+     * with `cacheLease` module option only the instance holding the redis lease executes prepareFn$,
+     * other instances wait for the value to appear in redis.
+     *
      * @see get$
      * @see set$
      *
@@ -213,15 +814,201 @@ export class NestJSRxJSRedisService {
                 concatMap(input => {
                     const key = keyFn(input);
 
-                    return this.get$(key).pipe(
-                        map(fromValueFn),
-                        catchError(() =>
-                            prepareFn$(key).pipe(
-                                concatMap(data => this.set$(key, toValueFn(data), ttlInSeconds).pipe(map(() => data)))
-                            )
-                        )
+                    const prepare$ = (): Observable<R> =>
+                        prepareFn$(key).pipe(
+                            concatMap(data => this.set$(key, toValueFn(data), ttlInSeconds).pipe(map(() => data)))
+                        );
+
+                    const load$ = (): Observable<R> => this.get$(key).pipe(map(fromValueFn));
+
+                    return load$().pipe(catchError(() => this.recompute$('cache', key, prepare$, load$)));
+                })
+            );
+    }
+
+    /**
+     * RxJS operator for cache operation with stale-while-revalidate.
+     *
+     * Value is stored together with its soft expiration and prepareFn$ compute time, and is kept in redis
+     * for `ttlInSeconds + staleTtlInSeconds`. After soft expiration, or earlier with XFetch probabilistic early
+     * expiration(see `cacheEarlyExpirationBeta` module option), stale value is returned immediately
+     * and prepareFn$ is executed in background. Only hard expiration makes subscribers wait for prepareFn$.
+     *
+     * @see cache
+     *
+     * @param ttlInSeconds Soft time to live in seconds
+     * @param staleTtlInSeconds Time in seconds the stale value can be served after soft expiration
+     * @param prepareFn$ Handler for getting/preparing data
+     * @param keyFn Redis key generation callback, by default takes input stream and uses emitted value as a key
+     * @param fromValueFn Handler for converting string data received from redis, JSON.parse by default
+     * @param toValueFn Handler for converting data to string for storage in redis, JSON.stringify by default
+     *
+     * @returns OperatorFunction RxJS operator
+     */
+    // eslint-disable-next-line @typescript-eslint/max-params
+    swrCache<R, T = string>(
+        ttlInSeconds: number,
+        staleTtlInSeconds: number,
+        prepareFn$: (input: string) => Observable<R>,
+        keyFn: (input: T) => string = input => String(input),
+        fromValueFn: (input: string) => R = input => JSON.parse(input) as R,
+        toValueFn: (input: R) => string = input => JSON.stringify(input)
+    ): OperatorFunction<T, R> {
+        return (source$: Observable<T>): Observable<R> =>
+            source$.pipe(
+                concatMap(input => {
+                    const key = keyFn(input);
+                    const fromEntryFn = (entry: string): StaleCacheEntryInterface<R> =>
+                        parseStaleCacheEntry(entry, fromValueFn);
+
+                    const prepare$ = (): Observable<StaleCacheEntryInterface<R>> =>
+                        defer(() => {
+                            const startedAt = Date.now();
+
+                            return prepareFn$(key).pipe(
+                                concatMap(value => {
+                                    const now = Date.now();
+                                    const entry = { expiresAt: now + ttlInSeconds * 1000, delta: now - startedAt, value };
+                                    const serialized = serializeStaleCacheEntry(entry, toValueFn);
+
+                                    return this.set$(key, serialized, ttlInSeconds + staleTtlInSeconds).pipe(
+                                        map(() => entry)
+                                    );
+                                })
+                            );
+                        });
+
+                    const load$ = (): Observable<StaleCacheEntryInterface<R>> => this.get$(key).pipe(map(fromEntryFn));
+
+                    return load$().pipe(
+                        tap(entry => {
+                            if (shouldRefreshStaleCacheEntry(entry, this.options.cacheEarlyExpirationBeta)) {
+                                this.refresh(key, () => this.recompute$('swrCache', key, prepare$, load$));
+                            }
+                        }),
+                        catchError(() => this.recompute$('swrCache', key, prepare$, load$)),
+                        map(entry => entry.value)
                     );
                 })
             );
     }
+
+    private clusterMget$<K extends string>(keys: K[]): Observable<Record<K, string | null>> {
+        const cluster = this.readClient as unknown as Cluster;
+
+        const nodes$ = groupByClusterNode(cluster, keys, key => key).map(nodeKeys => {
+            const slots = groupByClusterSlot(nodeKeys, key => key);
+
+            return from(cluster.pipeline(slots.map(slotKeys => ['mget', ...slotKeys])).exec()).pipe(
+                map(replies =>
+                    slots.map((slotKeys, idx) => {
+                        const [replyError, values] = replies?.[idx] ?? [new Error('Missing redis pipeline reply'), null];
+
+                        if (isDefined(replyError)) {
+                            throw replyError;
+                        }
+
+                        return zipKeysValues(slotKeys, values as Array<string | null>);
+                    })
+                )
+            );
+        });
+
+        return forkJoin(nodes$).pipe(
+            defaultIfEmpty([]),
+            map(records => Object.assign({}, ...records.flat()) as Record<K, string | null>)
+        );
+    }
+
+    private cursor$<T, R>(
+        scanFn: ScanFn,
+        parseFn: (elements: string[]) => T[],
+        batchFn$: (batch: T[]) => Observable<R>,
+        error: string
+    ): Observable<R> {
+        const page$ = (cursor: string): Observable<[cursor: string, results: R[]]> =>
+            from(scanFn(cursor)).pipe(
+                catchError(() => throwError(() => new Error(error))),
+                concatMap(([nextCursor, elements]) => {
+                    const batch = parseFn(elements);
+
+                    return (batch.length > 0 ? batchFn$(batch) : EMPTY).pipe(
+                        toArray(),
+                        map(results => [nextCursor, results] as [string, R[]])
+                    );
+                })
+            );
+
+        // HINT: expand subscribes to the next page only after emitting the current one, so SCAN calls are sequential
+        return page$('0').pipe(
+            expand(([cursor]) => (cursor === '0' ? EMPTY : page$(cursor)), 1),
+            concatMap(([, results]) => results)
+        );
+    }
+
+    /**
+     * Execute prepare$ for missing or expired cache key, applying singleflight and redis lease module options.
+     * Flights are keyed per operator, as operators share redis keys but emit different value types.
+     */
+    private recompute$<R>(
+        operator: CacheOperator,
+        key: string,
+        prepare$: () => Observable<R>,
+        load$: () => Observable<R>
+    ): Observable<R> {
+        const lease$ = (): Observable<R> =>
+            this.options.cacheLease ? this.prepareWithLease$(key, prepare$, load$) : prepare$();
+
+        return this.options.cacheSingleflight ? this.singleflight.run$(`${operator}:${key}`, lease$) : lease$();
+    }
+
+    private refresh<R>(key: string, recompute$: () => Observable<R>): void {
+        this.refreshes
+            .run$(key, () =>
+                recompute$().pipe(
+                    catchError((error: unknown) => {
+                        this.logger.warn(`Error refreshing stale ${key} cache value: ${getErrorMessage(error)}`);
+
+                        return EMPTY;
+                    })
+                )
+            )
+            .subscribe();
+    }
+
+    private prepareWithLease$<R>(key: string, prepare$: () => Observable<R>, load$: () => Observable<R>): Observable<R> {
+        const { cacheLeaseTtlInMs, cacheLeaseRetryDelayInMs } = this.options;
+        const leaseKey = `${key}:lease`;
+        // HINT: Lease holder token, so a holder whose lease has expired cannot release the lease of another instance
+        const leaseToken = randomBytes(LEASE_TOKEN_BYTES).toString('hex');
+        const release = (): void =>
+            void releaseLeaseScript.exec(this.redisClient, [leaseKey], [leaseToken]).catch(emptyFn);
+
+        return defer(() => this.redisClient.set(leaseKey, leaseToken, 'PX', cacheLeaseTtlInMs, 'NX')).pipe(
+            catchError(() => of(null)),
+            concatMap(lease =>
+                lease === 'OK'
+                    ? prepare$().pipe(finalize(release))
+                    : defer(load$).pipe(
+                          retry({
+                              count: Math.ceil(cacheLeaseTtlInMs / cacheLeaseRetryDelayInMs),
+                              delay: cacheLeaseRetryDelayInMs,
+                          }),
+                          // HINT: Lease holder has not saved the value in time, prepare it ourselves
+                          catchError(() => prepare$())
+                      )
+            )
+        );
+    }
+
+    private command$<T>(directFn: () => Promise<T>, ...command: RedisCommand): Observable<T> {
+        return from(isDefined(this.batcher) ? this.batcher.exec<T>(...command) : directFn());
+    }
+
+    // HINT: Replica reads use a separate connection, so only primary reads are auto batched
+    private read$<T>(readFn: (client: Redis) => Promise<T>, ...command: RedisCommand): Observable<T> {
+        return this.readClient === this.redisClient
+            ? this.command$(() => readFn(this.redisClient), ...command)
+            : from(readFn(this.readClient));
+    }
 }
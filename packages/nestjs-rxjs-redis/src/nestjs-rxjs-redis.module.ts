@@ -2,15 +2,19 @@ import { Module } from '@nestjs/common';
 
 import { NestJSRxJSRedisCoreModule } from './nestjs-rxjs-redis-core.module';
 
+import type { NestJSRxJSRedisModuleOptions } from './nestjs-rxjs-redis-module.options';
 import type { DynamicModule } from '@nestjs/common';
 import type { RedisModuleAsyncOptions } from '@nestjs-modules/ioredis';
 
 @Module({})
 export class NestJSRxJSRedisModule {
-    static forRootAsync(options: RedisModuleAsyncOptions): DynamicModule {
+    static forRootAsync(
+        options: RedisModuleAsyncOptions,
+        redisOptions: Partial<NestJSRxJSRedisModuleOptions> = {}
+    ): DynamicModule {
         return {
             module: NestJSRxJSRedisModule,
-            imports: [NestJSRxJSRedisCoreModule.forRootAsync(options)],
+            imports: [NestJSRxJSRedisCoreModule.forRootAsync(options, redisOptions)],
         };
     }
 }
@@ -0,0 +1,142 @@
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { RedisCommandBatcher } from './redis-command-batcher';
+
+import type { Redis } from 'ioredis';
+
+type PipelineReplies = Array<[Error | null, unknown]> | null;
+
+const getRedisClient = (exec: () => Promise<PipelineReplies>): { pipeline: jest.Mock; redis: Redis } => {
+    const pipeline = jest.fn().mockReturnValue({ exec });
+
+    return { pipeline, redis: { pipeline } as unknown as Redis };
+};
+
+describe('RedisCommandBatcher', () => {
+    it('should send commands issued in the same tick in one pipeline and de-multiplex replies', async () => {
+        expect.assertions(4);
+
+        const { pipeline, redis } = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue([
+                [null, 'value'],
+                [null, 'OK'],
+            ])
+        );
+        const batcher = new RedisCommandBatcher(redis);
+
+        const results = await Promise.all([batcher.exec('get', 'key'), batcher.exec('set', 'key', 'value', 'EX', 1)]);
+
+        expect(pipeline).toHaveBeenCalledTimes(1);
+        expect(pipeline).toHaveBeenCalledWith([
+            ['get', 'key'],
+            ['set', 'key', 'value', 'EX', 1],
+        ]);
+        expect(results).toStrictEqual(['value', 'OK']);
+        expect(batcher.getStats()).toMatchObject({ batches: 1, commands: 2, maxBatchSize: 2 });
+    });
+
+    it('should reject only failed command', async () => {
+        expect.assertions(2);
+
+        const error = new Error('WRONGTYPE');
+        const { redis } = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue([
+                [error, null],
+                [null, 1],
+            ])
+        );
+        const batcher = new RedisCommandBatcher(redis);
+
+        const [failed, succeeded] = await Promise.allSettled([batcher.exec('incr', 'key'), batcher.exec('del', 'key')]);
+
+        expect(failed).toStrictEqual({ status: 'rejected', reason: error });
+        expect(succeeded).toStrictEqual({ status: 'fulfilled', value: 1 });
+    });
+
+    it('should reject commands without pipeline reply', async () => {
+        expect.assertions(1);
+
+        const { redis } = getRedisClient(jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue(null));
+        const batcher = new RedisCommandBatcher(redis);
+
+        await expect(batcher.exec('get', 'key')).rejects.toThrow('Missing redis pipeline reply');
+    });
+
+    it('should reject all commands if pipeline fails', async () => {
+        expect.assertions(2);
+
+        const error = new Error('Connection is closed');
+        const { redis } = getRedisClient(jest.fn<() => Promise<PipelineReplies>>().mockRejectedValue(error));
+        const batcher = new RedisCommandBatcher(redis);
+
+        const results = await Promise.allSettled([batcher.exec('get', 'key1'), batcher.exec('get', 'key2')]);
+
+        expect(results).toStrictEqual([
+            { status: 'rejected', reason: error },
+            { status: 'rejected', reason: error },
+        ]);
+        expect(batcher.getStats()).toMatchObject({ batches: 1, commands: 2 });
+    });
+
+    it('should wait for batching window before sending pipeline', async () => {
+        expect.assertions(2);
+
+        const { pipeline, redis } = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue([
+                [null, 'value1'],
+                [null, 'value2'],
+            ])
+        );
+        const batcher = new RedisCommandBatcher(redis, 1);
+
+        const first = batcher.exec('get', 'key1');
+        await Promise.resolve();
+        const second = batcher.exec('get', 'key2');
+
+        await expect(Promise.all([first, second])).resolves.toStrictEqual(['value1', 'value2']);
+        expect(pipeline).toHaveBeenCalledTimes(1);
+    });
+
+    it('should send commands issued from promise microtasks of the same iteration in one pipeline', async () => {
+        expect.assertions(2);
+
+        const { pipeline, redis } = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue([
+                [null, 'value1'],
+                [null, 'value2'],
+            ])
+        );
+        const batcher = new RedisCommandBatcher(redis);
+
+        const first = batcher.exec('get', 'key1');
+        const second = Promise.resolve()
+            .then(() => Promise.resolve())
+            .then(() => batcher.exec('get', 'key2'));
+
+        await expect(Promise.all([first, second])).resolves.toStrictEqual(['value1', 'value2']);
+        expect(pipeline).toHaveBeenCalledTimes(1);
+    });
+
+    it('should send batch right away when it reaches max batch size', async () => {
+        expect.assertions(3);
+
+        const { pipeline, redis } = getRedisClient(
+            jest
+                .fn<() => Promise<PipelineReplies>>()
+                .mockResolvedValueOnce([
+                    [null, 'value1'],
+                    [null, 'value2'],
+                ])
+                .mockResolvedValueOnce([[null, 'value3']])
+        );
+        const batcher = new RedisCommandBatcher(redis, 1, 2);
+
+        const first = batcher.exec('get', 'key1');
+        const second = batcher.exec('get', 'key2');
+
+        expect(pipeline).toHaveBeenCalledTimes(1);
+        await expect(Promise.all([first, second])).resolves.toStrictEqual(['value1', 'value2']);
+
+        await expect(batcher.exec('get', 'key3')).resolves.toBe('value3');
+    });
+});
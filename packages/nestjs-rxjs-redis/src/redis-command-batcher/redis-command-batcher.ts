@@ -0,0 +1,106 @@
+import { emptyFn, isDefined } from '@rnw-community/shared';
+
+import type { RedisAutoBatchStatsInterface } from '../interface/redis-auto-batch-stats.interface';
+import type { Redis } from 'ioredis';
+
+export type RedisCommand = [command: string, ...args: Array<Buffer | number | string>];
+
+interface QueuedRedisCommand {
+    command: RedisCommand;
+    reject: (reason: unknown) => void;
+    resolve: (value: unknown) => void;
+}
+
+const NANOSECONDS_IN_MS = 1e6;
+
+/**
+ * Collects redis commands issued in the same event loop iteration(or batching window) and sends them in one pipeline,
+ * pipeline replies are de-multiplexed back to each command promise. Batch reaching `maxBatchSize` is sent right away.
+ *
+ * Unlike ioredis `enableAutoPipelining` connection option it is enabled per service without changing the shared
+ * connection, supports a batching window longer than one iteration and reports batch sizes and flush latencies.
+ */
+export class RedisCommandBatcher {
+    private queue: QueuedRedisCommand[] = [];
+    private queueStartedAt = process.hrtime.bigint();
+    private cancelScheduledFlush: () => void = emptyFn;
+
+    private readonly stats: RedisAutoBatchStatsInterface = {
+        batches: 0,
+        commands: 0,
+        lastFlushLatencyMs: 0,
+        maxBatchSize: 0,
+        maxFlushLatencyMs: 0,
+        totalFlushLatencyMs: 0,
+    };
+
+    constructor(
+        private readonly redisClient: Redis,
+        private readonly windowInMs = 0,
+        private readonly maxBatchSize = Infinity
+    ) {}
+
+    exec<T>(...command: RedisCommand): Promise<T> {
+        return new Promise<T>((resolve, reject) => {
+            this.queue.push({ command, resolve: resolve as (value: unknown) => void, reject });
+
+            if (this.queue.length === 1) {
+                this.queueStartedAt = process.hrtime.bigint();
+                this.scheduleFlush();
+            }
+
+            if (this.queue.length >= this.maxBatchSize) {
+                this.cancelScheduledFlush();
+                void this.flush();
+            }
+        });
+    }
+
+    getStats(): RedisAutoBatchStatsInterface {
+        return { ...this.stats };
+    }
+
+    private scheduleFlush(): void {
+        if (this.windowInMs > 0) {
+            const timeout = setTimeout(() => void this.flush(), this.windowInMs);
+            this.cancelScheduledFlush = () => void clearTimeout(timeout);
+        } else {
+            // HINT: setImmediate runs after all promise microtasks, so commands chained on resolved promises join the batch
+            const immediate = setImmediate(() => void this.flush());
+            this.cancelScheduledFlush = () => void clearImmediate(immediate);
+        }
+    }
+
+    private async flush(): Promise<void> {
+        const batch = this.queue;
+        const startedAt = this.queueStartedAt;
+        this.queue = [];
+
+        try {
+            const replies = (await this.redisClient.pipeline(batch.map(({ command }) => command)).exec()) ?? [];
+
+            batch.forEach(({ resolve, reject }, idx) => {
+                const [error, reply] = replies[idx] ?? [new Error('Missing redis pipeline reply'), null];
+
+                if (isDefined(error)) {
+                    reject(error);
+                } else {
+                    resolve(reply);
+                }
+            });
+        } catch (e) {
+            batch.forEach(({ reject }) => void reject(e));
+        }
+
+        this.updateStats(batch.length, Number(process.hrtime.bigint() - startedAt) / NANOSECONDS_IN_MS);
+    }
+
+    private updateStats(batchSize: number, flushLatencyMs: number): void {
+        this.stats.batches += 1;
+        this.stats.commands += batchSize;
+        this.stats.maxBatchSize = Math.max(this.stats.maxBatchSize, batchSize);
+        this.stats.lastFlushLatencyMs = flushLatencyMs;
+        this.stats.maxFlushLatencyMs = Math.max(this.stats.maxFlushLatencyMs, flushLatencyMs);
+        this.stats.totalFlushLatencyMs += flushLatencyMs;
+    }
+}
@@ -0,0 +1,50 @@
+import { createHash } from 'crypto';
+
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { RedisScript } from './redis-script';
+
+import type { Redis } from 'ioredis';
+
+const lua = 'return redis.call("GET", KEYS[1])';
+
+const getRedisClient = (evalsha: jest.Mock): { eval: jest.Mock; redis: Redis } => {
+    const evalFn = jest.fn<() => Promise<unknown>>().mockResolvedValue('evalValue');
+
+    return { eval: evalFn, redis: { eval: evalFn, evalsha } as unknown as Redis };
+};
+
+describe('RedisScript', () => {
+    it('should execute script by sha', async () => {
+        expect.assertions(3);
+
+        const script = new RedisScript<string>(lua);
+        const evalsha = jest.fn<() => Promise<unknown>>().mockResolvedValue('value');
+        const { eval: evalFn, redis } = getRedisClient(evalsha);
+
+        await expect(script.exec(redis, ['key'], [1])).resolves.toBe('value');
+        expect(evalsha).toHaveBeenCalledWith(createHash('sha1').update(lua).digest('hex'), 1, 'key', 1);
+        expect(evalFn).not.toHaveBeenCalled();
+    });
+
+    it('should fallback to eval if script is not cached by redis', async () => {
+        expect.assertions(2);
+
+        const script = new RedisScript<string>(lua);
+        const evalsha = jest.fn<() => Promise<unknown>>().mockRejectedValue(new Error('NOSCRIPT No matching script'));
+        const { eval: evalFn, redis } = getRedisClient(evalsha);
+
+        await expect(script.exec(redis, ['key'])).resolves.toBe('evalValue');
+        expect(evalFn).toHaveBeenCalledWith(lua, 1, 'key');
+    });
+
+    it('should rethrow other errors', async () => {
+        expect.assertions(1);
+
+        const script = new RedisScript<string>(lua);
+        const evalsha = jest.fn<() => Promise<unknown>>().mockRejectedValue(new Error('WRONGTYPE'));
+        const { redis } = getRedisClient(evalsha);
+
+        await expect(script.exec(redis, ['key'])).rejects.toThrow('WRONGTYPE');
+    });
+});
@@ -0,0 +1,31 @@
+import { createHash } from 'crypto';
+
+import { getErrorMessage } from '@rnw-community/shared';
+
+import type { Redis } from 'ioredis';
+
+export type RedisScriptArg = Buffer | number | string;
+
+/**
+ * Lua script executed by its SHA1 with EVALSHA, script body is sent with EVAL only if redis
+ * has not cached it yet(NOSCRIPT error), which also loads it into the redis script cache.
+ */
+export class RedisScript<T> {
+    readonly sha: string;
+
+    constructor(readonly lua: string) {
+        this.sha = createHash('sha1').update(lua).digest('hex');
+    }
+
+    async exec(redisClient: Redis, keys: string[], args: RedisScriptArg[] = []): Promise<T> {
+        try {
+            return (await redisClient.evalsha(this.sha, keys.length, ...keys, ...args)) as T;
+        } catch (e) {
+            if (!getErrorMessage(e).startsWith('NOSCRIPT')) {
+                throw e;
+            }
+
+            return (await redisClient.eval(this.lua, keys.length, ...keys, ...args)) as T;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+import { RedisScript } from './redis-script';
+
+// KEYS[1] - counter key, ARGV[1] - TTL in seconds, TTL is set on creation and repaired if it was lost
+export const incrWithTtlScript = new RedisScript<number>(`
+local value = redis.call('INCR', KEYS[1])
+if value == 1 or redis.call('TTL', KEYS[1]) == -1 then
+    redis.call('EXPIRE', KEYS[1], ARGV[1])
+end
+return value
+`);
+
+// KEYS[1] - hash key with `value` and `version` fields, ARGV[1] - value, ARGV[2] - expected version, ARGV[3] - TTL
+export const setIfVersionScript = new RedisScript<number>(`
+local version = tonumber(redis.call('HGET', KEYS[1], 'version') or '0')
+if version ~= tonumber(ARGV[2]) then
+    return -1
+end
+redis.call('HSET', KEYS[1], 'value', ARGV[1], 'version', version + 1)
+redis.call('EXPIRE', KEYS[1], ARGV[3])
+return version + 1
+`);
+
+// KEYS[1] - key, ARGV[1] - TTL in seconds
+export const getAndTouchScript = new RedisScript<string | null>(`
+local value = redis.call('GET', KEYS[1])
+if value then
+    redis.call('EXPIRE', KEYS[1], ARGV[1])
+end
+return value
+`);
+
+// KEYS[1] - lease key, ARGV[1] - lease token, lease is deleted only by its holder
+export const releaseLeaseScript = new RedisScript<number>(`
+if redis.call('GET', KEYS[1]) == ARGV[1] then
+    return redis.call('DEL', KEYS[1])
+end
+return 0
+`);
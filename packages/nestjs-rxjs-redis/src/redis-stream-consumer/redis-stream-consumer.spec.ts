@@ -0,0 +1,227 @@
+import { describe, expect, it, jest } from '@jest/globals';
+import { Logger } from '@nestjs/common';
+import { Subject, lastValueFrom, of, take, throwError, toArray } from 'rxjs';
+
+import { emptyFn } from '@rnw-community/shared';
+
+import { RedisStreamConsumer, defaultRedisStreamConsumerOptions } from './redis-stream-consumer';
+
+import type { RedisStreamEntryInterface } from '../interface/redis-stream-entry.interface';
+import type { Redis } from 'ioredis';
+import type { Observable } from 'rxjs';
+
+type PipelineReplies = Array<[Error | null, unknown]> | null;
+
+const stream = 'stream';
+const group = 'group';
+const consumer = 'consumer';
+const claimMinIdleInMs = 1000;
+const noRecovery = { claimMinIdleInMs: 0 };
+const { blockInMs, count } = defaultRedisStreamConsumerOptions;
+
+const getRedisClient = (
+    exec: () => Promise<PipelineReplies>,
+    xgroup = jest.fn<() => Promise<string>>().mockResolvedValue('OK')
+): { disconnect: jest.Mock; pipeline: jest.Mock; redis: Redis; xack: jest.Mock } => {
+    const pipeline = jest.fn().mockReturnValue({ exec });
+    const disconnect = jest.fn();
+    const xack = jest.fn<() => Promise<number>>().mockResolvedValue(1);
+    const client = { disconnect, pipeline, xack, xgroup };
+
+    return { disconnect, pipeline, redis: { duplicate: () => client } as unknown as Redis, xack };
+};
+
+const flushPromises = (): Promise<void> => new Promise(resolve => void setImmediate(resolve));
+
+const readReply = (...ids: string[]): [null, unknown] => [null, [[stream, ids.map(id => [id, ['value', id]])]]];
+const xreadgroup = ['xreadgroup', 'GROUP', group, consumer, 'COUNT', count, 'BLOCK', blockInMs, 'STREAMS', stream, '>'];
+const xautoclaim = (cursor: string): unknown[] => [
+    'xautoclaim',
+    stream,
+    group,
+    consumer,
+    claimMinIdleInMs,
+    cursor,
+    'COUNT',
+    count,
+];
+
+const getValue$ = (entry: RedisStreamEntryInterface): Observable<string> => of(entry.fields['value']);
+
+describe('RedisStreamConsumer', () => {
+    it('should handle read entries and acknowledge them with the next read', async () => {
+        expect.assertions(5);
+
+        const busyGroup = jest
+            .fn<() => Promise<string>>()
+            .mockRejectedValue(new Error('BUSYGROUP Consumer Group name already exists'));
+        const { disconnect, pipeline, redis, xack } = getRedisClient(
+            jest
+                .fn<() => Promise<PipelineReplies>>()
+                .mockResolvedValueOnce([readReply('1-0', '2-0')])
+                .mockResolvedValueOnce([[null, 2], readReply('3-0')]),
+            busyGroup
+        );
+        const consumer$ = new RedisStreamConsumer(redis, stream, group, consumer, {
+            ...noRecovery,
+            concurrency: 2,
+        }).consume$(getValue$);
+
+        await expect(lastValueFrom(consumer$.pipe(take(3), toArray()))).resolves.toStrictEqual(['1-0', '2-0', '3-0']);
+        expect(busyGroup).toHaveBeenCalledWith('CREATE', stream, group, '$', 'MKSTREAM');
+        expect(pipeline).toHaveBeenNthCalledWith(2, [['xack', stream, group, '1-0', '2-0'], xreadgroup]);
+
+        await flushPromises();
+
+        expect(xack).toHaveBeenCalledWith(stream, group, '3-0');
+        expect(disconnect).toHaveBeenCalledTimes(1);
+    });
+
+    it('should disconnect if acknowledgement of the last batch fails', async () => {
+        expect.assertions(2);
+
+        const { disconnect, redis, xack } = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValueOnce([readReply('1-0')])
+        );
+        xack.mockRejectedValue(new Error('FAIL'));
+        const consumer$ = new RedisStreamConsumer(redis, stream, group, consumer, noRecovery).consume$(getValue$);
+
+        await expect(lastValueFrom(consumer$.pipe(take(1)))).resolves.toBe('1-0');
+
+        await flushPromises();
+
+        expect(disconnect).toHaveBeenCalledTimes(1);
+    });
+
+    it('should emit handler results per entry without waiting for the whole batch', async () => {
+        expect.assertions(2);
+
+        const slow$ = new Subject<string>();
+        const { redis, xack } = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValueOnce([readReply('1-0', '2-0')])
+        );
+        const consumer$ = new RedisStreamConsumer(redis, stream, group, consumer, {
+            ...noRecovery,
+            concurrency: 2,
+        }).consume$(entry => (entry.id === '1-0' ? slow$ : getValue$(entry)));
+
+        await expect(lastValueFrom(consumer$.pipe(take(1)))).resolves.toBe('2-0');
+
+        await flushPromises();
+
+        expect(xack).toHaveBeenCalledWith(stream, group, '2-0');
+    });
+
+    it('should log and not acknowledge entries with failed handler', async () => {
+        expect.assertions(3);
+
+        const warn = jest.spyOn(Logger.prototype, 'warn').mockImplementation(emptyFn);
+
+        const { pipeline, redis } = getRedisClient(
+            jest
+                .fn<() => Promise<PipelineReplies>>()
+                .mockResolvedValueOnce([readReply('1-0', '2-0')])
+                .mockResolvedValueOnce([[null, 1], readReply('3-0')])
+        );
+        const consumer$ = new RedisStreamConsumer(redis, stream, group, consumer, noRecovery).consume$(entry =>
+            entry.id === '1-0' ? throwError(() => new Error('FAIL')) : getValue$(entry)
+        );
+
+        await expect(lastValueFrom(consumer$.pipe(take(2), toArray()))).resolves.toStrictEqual(['2-0', '3-0']);
+        expect(pipeline).toHaveBeenNthCalledWith(2, [['xack', stream, group, '2-0'], xreadgroup]);
+        expect(warn).toHaveBeenCalledWith(`Error handling ${stream} stream entry 1-0: FAIL`);
+
+        warn.mockRestore();
+    });
+
+    it('should claim pending entries on start and when stream is idle', async () => {
+        expect.assertions(5);
+
+        const { pipeline, redis } = getRedisClient(
+            jest
+                .fn<() => Promise<PipelineReplies>>()
+                .mockResolvedValueOnce([[null, ['5-0', [['1-0', ['value', '1-0']]]]]])
+                .mockResolvedValueOnce([[null, 1], [null, ['0-0', [['2-0', null]]]]])
+                .mockResolvedValueOnce([[null, 1], [null, null]])
+                .mockResolvedValueOnce([[null, ['0-0', [['3-0', ['value', '3-0']]]]]])
+        );
+        const consumer$ = new RedisStreamConsumer(redis, stream, group, consumer, { claimMinIdleInMs }).consume$(getValue$);
+
+        await expect(lastValueFrom(consumer$.pipe(take(2), toArray()))).resolves.toStrictEqual(['1-0', '3-0']);
+        expect(pipeline).toHaveBeenNthCalledWith(1, [xautoclaim('0-0')]);
+        expect(pipeline).toHaveBeenNthCalledWith(2, [['xack', stream, group, '1-0'], xautoclaim('5-0')]);
+        expect(pipeline).toHaveBeenNthCalledWith(3, [['xack', stream, group, '2-0'], xreadgroup]);
+        expect(pipeline).toHaveBeenNthCalledWith(4, [xautoclaim('0-0')]);
+    });
+
+    it('should claim pending entries on start by default', async () => {
+        expect.assertions(1);
+
+        const { pipeline, redis } = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValueOnce([[null, ['0-0', [['1-0', ['value', '1-0']]]]]])
+        );
+
+        await lastValueFrom(new RedisStreamConsumer(redis, stream, group, consumer).consume$(getValue$).pipe(take(1)));
+
+        const { claimMinIdleInMs: defaultClaimMinIdleInMs } = defaultRedisStreamConsumerOptions;
+
+        expect(pipeline).toHaveBeenNthCalledWith(1, [
+            ['xautoclaim', stream, group, consumer, defaultClaimMinIdleInMs, '0-0', 'COUNT', count],
+        ]);
+    });
+
+    it('should block reads for claimMinIdleInMs instead of forever if recovery is enabled', async () => {
+        expect.assertions(1);
+
+        const { pipeline, redis } = getRedisClient(
+            jest
+                .fn<() => Promise<PipelineReplies>>()
+                .mockResolvedValueOnce([[null, ['0-0', []]]])
+                .mockResolvedValueOnce([readReply('1-0')])
+        );
+        const consumer$ = new RedisStreamConsumer(redis, stream, group, consumer, {
+            blockInMs: 0,
+            claimMinIdleInMs,
+        }).consume$(getValue$);
+
+        await lastValueFrom(consumer$.pipe(take(1)));
+
+        expect(pipeline).toHaveBeenNthCalledWith(2, [
+            ['xreadgroup', 'GROUP', group, consumer, 'COUNT', count, 'BLOCK', claimMinIdleInMs, 'STREAMS', stream, '>'],
+        ]);
+    });
+
+    it('should throw error if stream read fails', async () => {
+        expect.assertions(3);
+
+        const readError = `Error reading ${stream} stream from redis`;
+        const failed = getRedisClient(jest.fn<() => Promise<PipelineReplies>>().mockRejectedValue(new Error('FAIL')));
+        const missing = getRedisClient(jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue(null));
+        const replyError = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>().mockResolvedValue([[new Error('NOGROUP'), null]])
+        );
+
+        await expect(
+            lastValueFrom(new RedisStreamConsumer(failed.redis, stream, group, consumer).consume$(getValue$))
+        ).rejects.toThrow(readError);
+        await expect(
+            lastValueFrom(new RedisStreamConsumer(missing.redis, stream, group, consumer).consume$(getValue$))
+        ).rejects.toThrow(readError);
+        await expect(
+            lastValueFrom(new RedisStreamConsumer(replyError.redis, stream, group, consumer).consume$(getValue$))
+        ).rejects.toThrow(readError);
+    });
+
+    it('should throw error if consumer group cannot be created', async () => {
+        expect.assertions(1);
+
+        const { redis } = getRedisClient(
+            jest.fn<() => Promise<PipelineReplies>>(),
+            jest.fn<() => Promise<string>>().mockRejectedValue(new Error('WRONGTYPE'))
+        );
+
+        await expect(
+            lastValueFrom(new RedisStreamConsumer(redis, stream, group, consumer).consume$(getValue$))
+        ).rejects.toThrow(`Error creating ${group} group for ${stream} stream in redis`);
+    });
+});
@@ -0,0 +1,191 @@
+import { Logger } from '@nestjs/common';
+import {
+    EMPTY,
+    catchError,
+    concat,
+    concatMap,
+    defer,
+    expand,
+    finalize,
+    from,
+    map,
+    mergeMap,
+    of,
+    tap,
+    throwError,
+} from 'rxjs';
+
+import { emptyFn, getErrorMessage, isDefined } from '@rnw-community/shared';
+
+import { toPairs } from '../util/to-pairs.util';
+
+import type { RedisStreamConsumerOptionsInterface } from '../interface/redis-stream-consumer-options.interface';
+import type { RedisStreamEntryInterface } from '../interface/redis-stream-entry.interface';
+import type { RedisCommand } from '../redis-command-batcher/redis-command-batcher';
+import type { Redis } from 'ioredis';
+import type { Observable } from 'rxjs';
+
+type RawStreamEntry = [id: string, fields: string[] | null];
+type XReadGroupReply = Array<[stream: string, entries: RawStreamEntry[]]> | null;
+type XAutoClaimReply = [cursor: string, entries: RawStreamEntry[]];
+
+interface StreamReadResult {
+    claimCursor: string | null;
+    entries: RawStreamEntry[];
+}
+
+// HINT: Handler results are emitted as soon as they arrive, batch end carries the cursor for the next read
+type StreamBatchEvent<R> = { claimCursor: string | null; isBatchEnd: true } | { isBatchEnd: false; result: R };
+
+const CLAIM_START_ID = '0-0';
+
+export const defaultRedisStreamConsumerOptions: RedisStreamConsumerOptionsInterface = {
+    blockInMs: 5000,
+    claimMinIdleInMs: 60000,
+    concurrency: 1,
+    count: 100,
+};
+
+/**
+ * Reads redis stream as a consumer group member on a dedicated connection, as blocking XREADGROUP
+ * would stall all other commands sent through the shared connection.
+ *
+ * Handler results are emitted per entry as they arrive, entry is acknowledged only after its handler completes,
+ * acknowledgements are sent by one XACK pipelined with the next read, or before disconnecting on unsubscribe.
+ * Failed entries are logged and stay pending, they are claimed by XAUTOCLAIM on start and whenever the stream is idle,
+ * so every entry is handled at least once.
+ */
+export class RedisStreamConsumer {
+    private readonly options: RedisStreamConsumerOptionsInterface;
+    private readonly logger = new Logger(RedisStreamConsumer.name);
+
+    // eslint-disable-next-line @typescript-eslint/max-params
+    constructor(
+        private readonly redisClient: Redis,
+        private readonly stream: string,
+        private readonly group: string,
+        private readonly consumer: string,
+        options: Partial<RedisStreamConsumerOptionsInterface> = {}
+    ) {
+        this.options = { ...defaultRedisStreamConsumerOptions, ...options };
+    }
+
+    consume$<R>(handler$: (entry: RedisStreamEntryInterface) => Observable<R>): Observable<R> {
+        return defer(() => {
+            const client = this.redisClient.duplicate();
+            // HINT: Handled entries, not acknowledged yet, are sent with the next read or before disconnecting
+            let ackIds: string[] = [];
+            const batch$ = (claimCursor: string | null): Observable<StreamBatchEvent<R>> => {
+                const sentAckIds = ackIds;
+                ackIds = [];
+
+                return this.read$(client, sentAckIds, claimCursor).pipe(
+                    concatMap(read =>
+                        concat(
+                            this.handle$(read.entries, handler$, id => void ackIds.push(id)).pipe(
+                                map(result => ({ isBatchEnd: false as const, result }))
+                            ),
+                            of({ claimCursor: read.claimCursor, isBatchEnd: true as const })
+                        )
+                    )
+                );
+            };
+
+            // HINT: expand sends the next read only after the current batch is handled, batches are sequential
+            return from(this.createGroup(client)).pipe(
+                concatMap(() => batch$(this.idleClaimCursor())),
+                expand(event => (event.isBatchEnd ? batch$(event.claimCursor) : EMPTY), 1),
+                concatMap(event => (event.isBatchEnd ? EMPTY : of(event.result))),
+                finalize(() => void this.disconnect(client, ackIds))
+            );
+        });
+    }
+
+    private async disconnect(client: Redis, ackIds: string[]): Promise<void> {
+        // HINT: Failed XACK is not an error, not acknowledged entries are claimed again
+        if (ackIds.length > 0) {
+            await client.xack(this.stream, this.group, ...ackIds).catch(emptyFn);
+        }
+
+        client.disconnect();
+    }
+
+    private idleClaimCursor(): string | null {
+        return this.options.claimMinIdleInMs > 0 ? CLAIM_START_ID : null;
+    }
+
+    private async createGroup(client: Redis): Promise<void> {
+        try {
+            await client.xgroup('CREATE', this.stream, this.group, '$', 'MKSTREAM');
+        } catch (e) {
+            if (!(e instanceof Error && e.message.startsWith('BUSYGROUP'))) {
+                throw new Error(`Error creating ${this.group} group for ${this.stream} stream in redis`);
+            }
+        }
+    }
+
+    private read$(client: Redis, ackIds: string[], claimCursor: string | null): Observable<StreamReadResult> {
+        const { blockInMs, claimMinIdleInMs, count } = this.options;
+        const { consumer, group, stream } = this;
+
+        const ackCommands: RedisCommand[] = ackIds.length > 0 ? [['xack', stream, group, ...ackIds]] : [];
+        // HINT: BLOCK 0 never times out, so with recovery enabled reads wait at most claimMinIdleInMs for idle claims
+        const readBlockInMs = blockInMs === 0 ? claimMinIdleInMs : blockInMs;
+        const readCommand: RedisCommand = isDefined(claimCursor)
+            ? ['xautoclaim', stream, group, consumer, claimMinIdleInMs, claimCursor, 'COUNT', count]
+            : ['xreadgroup', 'GROUP', group, consumer, 'COUNT', count, 'BLOCK', readBlockInMs, 'STREAMS', stream, '>'];
+
+        // HINT: Failed XACK is not an error, not acknowledged entries are claimed again
+        return from(client.pipeline([...ackCommands, readCommand]).exec()).pipe(
+            map(replies => {
+                const [error, reply] = replies?.[ackCommands.length] ?? [new Error('Missing redis pipeline reply'), null];
+
+                if (isDefined(error)) {
+                    throw error;
+                }
+
+                return isDefined(claimCursor)
+                    ? this.parseClaim(reply as XAutoClaimReply)
+                    : this.parseRead(reply as XReadGroupReply);
+            }),
+            catchError(() => throwError(() => new Error(`Error reading ${stream} stream from redis`)))
+        );
+    }
+
+    private parseRead(reply: XReadGroupReply): StreamReadResult {
+        // HINT: Empty reply means BLOCK timeout, the stream is idle and pending entries can be recovered
+        return isDefined(reply)
+            ? { claimCursor: null, entries: reply[0][1] }
+            : { claimCursor: this.idleClaimCursor(), entries: [] };
+    }
+
+    private parseClaim([cursor, entries]: XAutoClaimReply): StreamReadResult {
+        return { claimCursor: cursor === CLAIM_START_ID ? null : cursor, entries };
+    }
+
+    private handle$<R>(
+        entries: RawStreamEntry[],
+        handler$: (entry: RedisStreamEntryInterface) => Observable<R>,
+        onHandled: (id: string) => void
+    ): Observable<R> {
+        // HINT: Entry deleted from the stream is still pending, it is acknowledged without handling
+        const entry$ = (id: string, fields: string[] | null): Observable<R> =>
+            isDefined(fields) ? handler$({ id, fields: Object.fromEntries(toPairs(fields, String)) }) : EMPTY;
+
+        return from(entries).pipe(
+            mergeMap(
+                ([id, fields]) =>
+                    entry$(id, fields).pipe(
+                        tap({ complete: () => void onHandled(id) }),
+                        // HINT: Failed entry is not acknowledged and stays pending
+                        catchError((e: unknown) => {
+                            this.logger.warn(`Error handling ${this.stream} stream entry ${id}: ${getErrorMessage(e)}`);
+
+                            return EMPTY;
+                        })
+                    ),
+                this.options.concurrency
+            )
+        );
+    }
+}
@@ -0,0 +1,39 @@
+import { describe, expect, it, jest } from '@jest/globals';
+import { Subject, lastValueFrom, of } from 'rxjs';
+
+import { Singleflight } from './singleflight';
+
+describe('Singleflight', () => {
+    it('should share one in-flight observable per key', async () => {
+        expect.assertions(4);
+
+        const subject$ = new Subject<string>();
+        const factory$ = jest.fn(() => subject$);
+        const singleflight = new Singleflight();
+
+        const first = lastValueFrom(singleflight.run$('key', factory$));
+        const second = lastValueFrom(singleflight.run$('key', factory$));
+
+        expect(singleflight.size).toBe(1);
+
+        subject$.next('value');
+        subject$.complete();
+
+        await expect(Promise.all([first, second])).resolves.toStrictEqual(['value', 'value']);
+        expect(factory$).toHaveBeenCalledTimes(1);
+        expect(singleflight.size).toBe(0);
+    });
+
+    it('should run factory again after previous run finished', async () => {
+        expect.assertions(2);
+
+        const factory$ = jest.fn(() => of('value'));
+        const singleflight = new Singleflight();
+
+        await lastValueFrom(singleflight.run$('key', factory$));
+        await lastValueFrom(singleflight.run$('key', factory$));
+
+        expect(factory$).toHaveBeenCalledTimes(2);
+        expect(singleflight.size).toBe(0);
+    });
+});
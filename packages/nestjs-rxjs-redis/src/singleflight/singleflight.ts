@@ -0,0 +1,33 @@
+import { finalize, shareReplay } from 'rxjs';
+
+import { isDefined } from '@rnw-community/shared';
+
+import type { Observable } from 'rxjs';
+
+/**
+ * Shares one in-flight observable per key between all concurrent subscribers.
+ */
+export class Singleflight {
+    private readonly inFlight = new Map<string, Observable<unknown>>();
+
+    get size(): number {
+        return this.inFlight.size;
+    }
+
+    run$<T>(key: string, factory$: () => Observable<T>): Observable<T> {
+        const inFlight$ = this.inFlight.get(key);
+
+        if (isDefined(inFlight$)) {
+            return inFlight$ as Observable<T>;
+        }
+
+        const shared$ = factory$().pipe(
+            finalize(() => void this.inFlight.delete(key)),
+            shareReplay({ bufferSize: 1, refCount: false })
+        );
+
+        this.inFlight.set(key, shared$);
+
+        return shared$;
+    }
+}
@@ -0,0 +1,18 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { chunkArray } from './chunk-array.util';
+
+describe('chunkArray', () => {
+    it('should split array into chunks', () => {
+        expect.assertions(2);
+
+        expect(chunkArray(['a', 'b', 'c'], 2)).toStrictEqual([['a', 'b'], ['c']]);
+        expect(chunkArray([], 2)).toStrictEqual([]);
+    });
+
+    it.each([0, -1, 1.5, Infinity, NaN])('should throw on invalid chunk size %s', chunkSize => {
+        expect.assertions(1);
+
+        expect(() => chunkArray(['a'], chunkSize)).toThrow(`Invalid chunk size "${chunkSize}"`);
+    });
+});
@@ -0,0 +1,9 @@
+export const chunkArray = <T>(array: T[], chunkSize: number): T[][] => {
+    if (!Number.isInteger(chunkSize) || chunkSize <= 0) {
+        throw new Error(`Invalid chunk size "${chunkSize}", positive integer expected`);
+    }
+
+    return Array.from({ length: Math.ceil(array.length / chunkSize) }, (_, idx) =>
+        array.slice(idx * chunkSize, (idx + 1) * chunkSize)
+    );
+};
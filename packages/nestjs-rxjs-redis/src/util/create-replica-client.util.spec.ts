@@ -0,0 +1,41 @@
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { createReplicaClient } from './create-replica-client.util';
+
+import type { Redis } from 'ioredis';
+
+const replicaClient = {} as Redis;
+
+describe('createReplicaClient', () => {
+    it('should create cluster connection with reads scaled to replicas', () => {
+        expect.assertions(2);
+
+        const duplicate = jest.fn().mockReturnValue(replicaClient);
+        const redisClient = { duplicate, isCluster: true, options: {} } as unknown as Redis;
+
+        expect(createReplicaClient(redisClient)).toBe(replicaClient);
+        expect(duplicate).toHaveBeenCalledWith(undefined, { scaleReads: 'slave' });
+    });
+
+    it('should create sentinel connection to replica', () => {
+        expect.assertions(2);
+
+        const duplicate = jest.fn().mockReturnValue(replicaClient);
+        const redisClient = {
+            duplicate,
+            isCluster: false,
+            options: { sentinels: [{ host: 'sentinel', port: 26379 }] },
+        } as unknown as Redis;
+
+        expect(createReplicaClient(redisClient)).toBe(replicaClient);
+        expect(duplicate).toHaveBeenCalledWith({ role: 'slave' });
+    });
+
+    it('should return single node connection as is', () => {
+        expect.assertions(1);
+
+        const redisClient = { isCluster: false, options: {} } as unknown as Redis;
+
+        expect(createReplicaClient(redisClient)).toBe(redisClient);
+    });
+});
@@ -0,0 +1,15 @@
+import { isNotEmptyArray } from '@rnw-community/shared';
+
+import type { Cluster, Redis } from 'ioredis';
+
+/**
+ * Create connection for reading from replicas: cluster connection with reads scaled to replicas,
+ * or sentinel connection to a replica. Single node connection is returned as is.
+ */
+export const createReplicaClient = (redisClient: Redis): Redis => {
+    if (redisClient.isCluster) {
+        return (redisClient as unknown as Cluster).duplicate(undefined, { scaleReads: 'slave' }) as unknown as Redis;
+    }
+
+    return isNotEmptyArray(redisClient.options.sentinels) ? redisClient.duplicate({ role: 'slave' }) : redisClient;
+};
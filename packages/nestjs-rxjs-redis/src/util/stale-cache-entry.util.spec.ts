@@ -0,0 +1,46 @@
+import { describe, expect, it } from '@jest/globals';
+
+import {
+    parseStaleCacheEntry,
+    serializeStaleCacheEntry,
+    shouldRefreshStaleCacheEntry,
+} from './stale-cache-entry.util';
+
+const entry = { expiresAt: 10000, delta: 100, value: { id: 'a:b' } };
+// HINT: XFetch refreshes early when -ln(random) * delta * beta exceeds time left till expiration
+const refreshRandom = Math.exp(-2);
+const keepRandom = Math.exp(-0.5);
+const smallRandom = 0.01;
+
+describe('stale cache entry', () => {
+    it('should serialize and parse entry', () => {
+        expect.assertions(2);
+
+        const serialized = serializeStaleCacheEntry(entry, JSON.stringify);
+
+        expect(serialized).toBe('10000:100:{"id":"a:b"}');
+        expect(parseStaleCacheEntry(serialized, JSON.parse)).toStrictEqual(entry);
+    });
+
+    it.each(['{"id":"a"}', '10000:{"id":"a"}', 'a:b:{"id":"a"}'])('should throw on invalid entry %s', serialized => {
+        expect.assertions(1);
+
+        expect(() => parseStaleCacheEntry(serialized, JSON.parse)).toThrow('Invalid stale cache entry');
+    });
+
+    it('should refresh entry after soft expiration', () => {
+        expect.assertions(1);
+
+        expect(shouldRefreshStaleCacheEntry(entry, 1, entry.expiresAt, 1)).toBe(true);
+    });
+
+    it('should refresh entry early with probability depending on compute time', () => {
+        expect.assertions(3);
+
+        const now = entry.expiresAt - entry.delta;
+
+        expect(shouldRefreshStaleCacheEntry(entry, 1, now, refreshRandom)).toBe(true);
+        expect(shouldRefreshStaleCacheEntry(entry, 1, now, keepRandom)).toBe(false);
+        expect(shouldRefreshStaleCacheEntry(entry, 0, now, smallRandom)).toBe(false);
+    });
+});
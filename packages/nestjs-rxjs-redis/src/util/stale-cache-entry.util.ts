@@ -0,0 +1,37 @@
+import type { StaleCacheEntryInterface } from '../interface/stale-cache-entry.interface';
+
+const SEPARATOR = ':';
+
+/**
+ * Serialize entry as `expiresAt:delta:value`, so value is stored without additional escaping.
+ */
+export const serializeStaleCacheEntry = <T>(
+    { expiresAt, delta, value }: StaleCacheEntryInterface<T>,
+    toValueFn: (input: T) => string
+): string => `${expiresAt}${SEPARATOR}${delta}${SEPARATOR}${toValueFn(value)}`;
+
+export const parseStaleCacheEntry = <T>(entry: string, fromValueFn: (input: string) => T): StaleCacheEntryInterface<T> => {
+    const expiresAtEnd = entry.indexOf(SEPARATOR);
+    const deltaEnd = entry.indexOf(SEPARATOR, expiresAtEnd + 1);
+    const expiresAt = Number(entry.slice(0, expiresAtEnd));
+    const delta = Number(entry.slice(expiresAtEnd + 1, deltaEnd));
+
+    if (expiresAtEnd <= 0 || deltaEnd < 0 || Number.isNaN(expiresAt) || Number.isNaN(delta)) {
+        throw new Error(`Invalid stale cache entry "${entry}"`);
+    }
+
+    return { expiresAt, delta, value: fromValueFn(entry.slice(deltaEnd + 1)) };
+};
+
+/**
+ * XFetch probabilistic early expiration, the closer entry is to its soft expiration and the longer
+ * it takes to compute, the more likely it is refreshed, so refreshes do not cluster exactly at expiration.
+ *
+ * @see https://cseweb.ucsd.edu/~avattani/papers/cache_stampede.pdf
+ */
+export const shouldRefreshStaleCacheEntry = <T>(
+    { expiresAt, delta }: StaleCacheEntryInterface<T>,
+    beta: number,
+    now = Date.now(),
+    random = Math.random()
+): boolean => now - delta * beta * Math.log(random) >= expiresAt;
@@ -0,0 +1,15 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { toPairs } from './to-pairs.util';
+
+describe('toPairs', () => {
+    it('should convert flat reply into pairs', () => {
+        expect.assertions(2);
+
+        expect(toPairs(['a', '1', 'b', '2'], String)).toStrictEqual([
+            ['a', '1'],
+            ['b', '2'],
+        ]);
+        expect(toPairs(['a', '1', 'b'], Number)).toStrictEqual([['a', 1]]);
+    });
+});
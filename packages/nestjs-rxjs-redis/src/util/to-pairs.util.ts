@@ -0,0 +1,12 @@
+/**
+ * Convert flat redis reply `[field1, value1, field2, value2, ...]` into pairs.
+ */
+export const toPairs = <T>(elements: string[], valueFn: (value: string) => T): Array<[string, T]> => {
+    const pairs: Array<[string, T]> = [];
+
+    for (let idx = 0; idx < elements.length - 1; idx += 2) {
+        pairs.push([elements[idx], valueFn(elements[idx + 1])]);
+    }
+
+    return pairs;
+};
@@ -0,0 +1,11 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { zipKeysValues } from './zip-keys-values.util';
+
+describe('zipKeysValues', () => {
+    it('should build object from keys and values', () => {
+        expect.assertions(1);
+
+        expect(zipKeysValues(['a', 'b', 'c'], ['1', null])).toStrictEqual({ a: '1', b: null, c: null });
+    });
+});
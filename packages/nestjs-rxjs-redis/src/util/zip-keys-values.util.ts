@@ -0,0 +1,12 @@
+/**
+ * Build object from keys and values arrays in linear time, missing values are set to null.
+ */
+export const zipKeysValues = <K extends string, V>(keys: K[], values: V[]): Record<K, V | null> => {
+    const result = {} as Record<K, V | null>;
+
+    for (let idx = 0; idx < keys.length; idx++) {
+        result[keys[idx]] = values[idx] ?? null;
+    }
+
+    return result;
+};
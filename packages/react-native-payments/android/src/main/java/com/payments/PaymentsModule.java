@@ -15,6 +15,7 @@ import com.google.android.gms.tasks.OnCompleteListener;
 import com.google.android.gms.wallet.*;
 
 import com.facebook.react.bridge.ActivityEventListener;
+import com.facebook.react.bridge.Arguments;
 import com.facebook.react.bridge.Promise;
 import com.facebook.react.bridge.ReactApplicationContext;
 import com.facebook.react.bridge.ReactMethod;
@@ -176,6 +177,16 @@ public class PaymentsModule extends PaymentsSpec {
         promise.resolve("AndroidPay complete is not supported");
     }
 
+    @ReactMethod
+    public void setTokenizationOptions(ReadableMap options) {
+        Log.d(NAME, "Tokenization options are not supported by AndroidPay " + options.toString());
+    }
+
+    @ReactMethod
+    public void getTokenizationStats(Promise promise) {
+        promise.resolve(Arguments.createMap());
+    }
+
     /**
      * PaymentData response object contains the payment information, as well as any additional
      * requested information, such as billing and shipping address.
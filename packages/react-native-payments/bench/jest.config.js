@@ -0,0 +1 @@
+module.exports = require('../../../get-bench-jest.config.js')('react-native-payments');
@@ -0,0 +1,100 @@
+import { afterAll, describe, it, jest } from '@jest/globals';
+import { Platform } from 'react-native';
+
+import { formatSpeedup, runBenchmark } from '../../../bench/benchmark';
+import { PaymentRequest } from '../src/class/payment-request/payment-request';
+import { PaymentRequestTemplate } from '../src/class/payment-request-template/payment-request-template';
+import { AndroidPaymentResponse } from '../src/class/payment-response/android-payment-response';
+import { IosPaymentResponse } from '../src/class/payment-response/ios-payment-response';
+import { PaymentMethodNameEnum } from '../src/enum/payment-method-name.enum';
+import { validateDisplayItems } from '../src/util/validate-display-items.util';
+import { validatePaymentMethods } from '../src/util/validate-payment-methods.util';
+import { validateTotal } from '../src/util/validate-total.util';
+
+import androidPaymentData from './fixtures/android-payment-data.json';
+import details from './fixtures/details.json';
+import iosPKPayment from './fixtures/ios-pk-payment.json';
+import methodData from './fixtures/method-data.json';
+
+import type { BenchmarkResult } from '../../../bench/benchmark';
+import type { PaymentDetailsInit } from '../src/@standard/w3c/payment-details-init';
+import type { PaymentMethodData } from '../src/@standard/w3c/payment-method-data';
+
+jest.mock('react-native', () => ({
+    NativeModules: {},
+    Platform: { OS: 'ios', select: () => '' },
+    TurboModuleRegistry: { get: () => null },
+}));
+
+const paymentMethodData = methodData as PaymentMethodData[];
+const paymentDetails = (): PaymentDetailsInit => ({ ...details });
+const androidPaymentDataJson = JSON.stringify(androidPaymentData);
+const iosPKPaymentJson = JSON.stringify(iosPKPayment);
+
+const readAllDetails = (response: AndroidPaymentResponse | IosPaymentResponse): unknown => ({ ...response.details });
+const readPayerDetails = ({ details }: AndroidPaymentResponse | IosPaymentResponse): unknown => ({
+    payerEmail: details.payerEmail,
+    payerName: details.payerName,
+    payerPhone: details.payerPhone,
+});
+const createPaymentRequest = (): PaymentRequest => new PaymentRequest(paymentMethodData, paymentDetails());
+
+const platforms = ['android', 'ios'] as const;
+
+// HINT: Stages are reported relative to a reference measured in the same run, so absolute machine speed does not matter
+const speedups: Array<{ reference: string; speedup: string; stage: string }> = [];
+const report = (stage: string, result: BenchmarkResult, reference: string, referenceResult: BenchmarkResult): void =>
+    void speedups.push({ reference, speedup: formatSpeedup(result, referenceResult), stage });
+
+describe('ReactNativePayments request/response pipeline', () => {
+    // eslint-disable-next-line jest/no-hooks
+    afterAll(() => {
+        // eslint-disable-next-line no-console
+        console.table(speedups);
+    });
+
+    it.each(platforms)('validators share of PaymentRequest constructor (%s)', platform => {
+        Platform.OS = platform;
+
+        const reference = runBenchmark(`payment-request-${platform}`, createPaymentRequest);
+        const result = runBenchmark(`validators-${platform}`, () => {
+            validatePaymentMethods(paymentMethodData);
+            validateTotal(details.total);
+            validateDisplayItems(details.displayItems);
+        });
+
+        report(`validators-${platform}`, result, `payment-request-${platform}`, reference);
+    });
+
+    it.each(platforms)('PaymentRequest from template compared with constructor (%s)', platform => {
+        Platform.OS = platform;
+        const template = new PaymentRequestTemplate(paymentMethodData);
+
+        const reference = runBenchmark(`payment-request-${platform}`, createPaymentRequest);
+        const result = runBenchmark(`payment-request-template-${platform}`, () =>
+            PaymentRequest.fromTemplate(template, paymentDetails())
+        );
+
+        report(`payment-request-template-${platform}`, result, `payment-request-${platform}`, reference);
+    });
+
+    it('AndroidPaymentResponse decodes payment token lazily', () => {
+        const createResponse = (): AndroidPaymentResponse =>
+            new AndroidPaymentResponse('id', PaymentMethodNameEnum.AndroidPay, androidPaymentDataJson);
+
+        const reference = runBenchmark('android-payment-response', () => readAllDetails(createResponse()));
+        const result = runBenchmark('android-payment-response-payer', () => readPayerDetails(createResponse()));
+
+        report('android-payment-response-payer', result, 'android-payment-response', reference);
+    });
+
+    it('IosPaymentResponse decodes payment data lazily', () => {
+        const createResponse = (): IosPaymentResponse =>
+            new IosPaymentResponse('id', PaymentMethodNameEnum.ApplePay, iosPKPaymentJson);
+
+        const reference = runBenchmark('ios-payment-response', () => readAllDetails(createResponse()));
+        const result = runBenchmark('ios-payment-response-payer', () => readPayerDetails(createResponse()));
+
+        report('ios-payment-response-payer', result, 'ios-payment-response', reference);
+    });
+});
@@ -19,5 +19,10 @@
 @property (nonatomic, copy) void (^__strong _Nonnull completion)(PKPaymentAuthorizationResult * _Nonnull __strong);
 @property (nonatomic, copy) RCTPromiseResolveBlock _Nullable paymentResolve;
 @property (nonatomic, copy) RCTPromiseRejectBlock _Nullable paymentReject;
+// Tokenization client configuration, see setTokenizationOptions
+@property (nonatomic, assign) NSTimeInterval tokenizationAttemptTimeout;
+@property (nonatomic, assign) NSTimeInterval tokenizationHedgeDelay;
+@property (nonatomic, assign) NSInteger tokenizationMaxAttempts;
+@property (nonatomic, strong) NSMutableDictionary<NSString *, NSNumber *> * _Nonnull tokenizationStats;
 
 @end
@@ -12,6 +12,33 @@ RCT_EXPORT_MODULE()
 static const PKMerchantCapability PKMerchantCapabilityUnknown = 9999;
 static const PKPaymentNetwork PKPaymentNetworkUnknown = 0;
 
+static const NSTimeInterval DefaultTokenizationAttemptTimeout = 10.0;
+// HINT: Hedged attempts are disabled by default, set hedgeDelayMs close to the gateway p95 latency to enable them
+static const NSTimeInterval DefaultTokenizationHedgeDelay = 0;
+static const NSInteger DefaultTokenizationMaxAttempts = 2;
+
+- (instancetype)init
+{
+    if (self = [super init]) {
+        self.tokenizationAttemptTimeout = DefaultTokenizationAttemptTimeout;
+        self.tokenizationHedgeDelay = DefaultTokenizationHedgeDelay;
+        self.tokenizationMaxAttempts = DefaultTokenizationMaxAttempts;
+        self.tokenizationStats = [@{
+            @"requests": @0,
+            @"attempts": @0,
+            @"hedgedAttempts": @0,
+            @"successes": @0,
+            @"failures": @0,
+            @"timeouts": @0,
+            @"lastLatencyMs": @0,
+            @"maxLatencyMs": @0,
+            @"totalLatencyMs": @0,
+        } mutableCopy];
+    }
+
+    return self;
+}
+
 // https://reactnative.dev/docs/native-modules-ios#threading
 - (dispatch_queue_t)methodQueue
 {
@@ -23,6 +50,24 @@ RCT_EXPORT_METHOD(setApiEndpoint:(NSString *)endpoint) {
     NSLog(@"BMSAPI endpoint set to: %@", endpoint);
 }
 
+RCT_EXPORT_METHOD(setTokenizationOptions:(NSDictionary *)options) {
+    if (options[@"attemptTimeoutMs"]) {
+        self.tokenizationAttemptTimeout = [options[@"attemptTimeoutMs"] doubleValue] / 1000.0;
+    }
+    if (options[@"hedgeDelayMs"]) {
+        self.tokenizationHedgeDelay = [options[@"hedgeDelayMs"] doubleValue] / 1000.0;
+    }
+    if (options[@"maxAttempts"]) {
+        self.tokenizationMaxAttempts = MAX(1, [options[@"maxAttempts"] integerValue]);
+    }
+}
+
+RCT_EXPORT_METHOD(getTokenizationStats: (RCTPromiseResolveBlock)resolve
+                                        reject:(RCTPromiseRejectBlock)reject)
+{
+    resolve([self.tokenizationStats copy]);
+}
+
 RCT_EXPORT_METHOD(show:(NSString *)methodDataString
                         details:(NSDictionary *)details
                         resolve:(RCTPromiseResolveBlock)resolve
@@ -261,7 +306,7 @@ RCT_EXPORT_METHOD(canMakePayments: (NSString *)methodDataString
 
     // TODO: Add shippingMethod
 
-    [[BMSAPI instance] generateTokenForApplePay:(PKPayment *)payment completion:^(NSString * _Nullable token, NSError * _Nullable error) {
+    [self generateTokenForApplePay:payment completion:^(NSString * _Nullable token, NSError * _Nullable error) {
             if (token) {
                 paymentDict[@"cardpointeToken"] = token;
                 NSError *error;
@@ -288,6 +333,110 @@ RCT_EXPORT_METHOD(canMakePayments: (NSString *)methodDataString
 
 // PRIVATE METHODS
 
+// Runs BMSAPI tokenization attempts with per attempt deadline, retry on failure and optional hedged attempt, first token wins
+- (void)generateTokenForApplePay:(PKPayment *_Nonnull)payment completion:(void (^_Nonnull)(NSString * _Nullable token, NSError * _Nullable error))completion
+{
+    CFTimeInterval startTime = CACurrentMediaTime();
+    NSMutableArray<NSURLSessionTask *> *tasks = [NSMutableArray array];
+
+    __block BOOL finished = NO;
+    __block NSInteger startedAttempts = 0;
+    __block NSInteger pendingAttempts = 0;
+    __block NSError *lastError = nil;
+    __block void (^startAttempt)(BOOL isHedged);
+
+    [self incrementTokenizationStat:@"requests" by:1];
+
+    void (^finish)(NSString *, NSError *) = ^(NSString *token, NSError *error) {
+        finished = YES;
+        startAttempt = nil;
+
+        for (NSURLSessionTask *task in tasks) {
+            [task cancel];
+        }
+
+        NSInteger latencyMs = (NSInteger)((CACurrentMediaTime() - startTime) * 1000);
+        [self incrementTokenizationStat:(token ? @"successes" : @"failures") by:1];
+        [self incrementTokenizationStat:@"totalLatencyMs" by:latencyMs];
+        self.tokenizationStats[@"lastLatencyMs"] = @(latencyMs);
+        self.tokenizationStats[@"maxLatencyMs"] = @(MAX(latencyMs, [self.tokenizationStats[@"maxLatencyMs"] integerValue]));
+
+        completion(token, error);
+    };
+
+    void (^attemptFailed)(NSError *) = ^(NSError *error) {
+        lastError = error;
+        pendingAttempts--;
+
+        if (startedAttempts < self.tokenizationMaxAttempts) {
+            startAttempt(NO);
+        } else if (pendingAttempts == 0) {
+            finish(nil, lastError);
+        }
+    };
+
+    startAttempt = ^(BOOL isHedged) {
+        if (finished || startedAttempts >= self.tokenizationMaxAttempts) {
+            return;
+        }
+
+        startedAttempts++;
+        pendingAttempts++;
+        [self incrementTokenizationStat:@"attempts" by:1];
+        if (isHedged) {
+            [self incrementTokenizationStat:@"hedgedAttempts" by:1];
+        }
+
+        __block BOOL attemptFinished = NO;
+
+        NSURLSessionTask *task = [[BMSAPI instance] generateTokenForApplePay:payment completion:^(NSString * _Nullable token, NSError * _Nullable error) {
+            dispatch_async(dispatch_get_main_queue(), ^{
+                if (attemptFinished || finished) {
+                    return;
+                }
+                attemptFinished = YES;
+
+                if (token) {
+                    pendingAttempts--;
+                    finish(token, nil);
+                } else {
+                    attemptFailed(error);
+                }
+            });
+        }];
+
+        if (task) {
+            [tasks addObject:task];
+        }
+
+        dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.tokenizationAttemptTimeout * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+            if (attemptFinished || finished) {
+                return;
+            }
+            attemptFinished = YES;
+
+            [task cancel];
+            [self incrementTokenizationStat:@"timeouts" by:1];
+            attemptFailed([NSError errorWithDomain:NSURLErrorDomain code:NSURLErrorTimedOut userInfo:@{NSLocalizedDescriptionKey: @"Cardpointe tokenization attempt timed out"}]);
+        });
+
+        if (self.tokenizationHedgeDelay > 0) {
+            dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(self.tokenizationHedgeDelay * NSEC_PER_SEC)), dispatch_get_main_queue(), ^{
+                if (!attemptFinished && !finished && startAttempt) {
+                    startAttempt(YES);
+                }
+            });
+        }
+    };
+
+    startAttempt(NO);
+}
+
+- (void)incrementTokenizationStat:(NSString *_Nonnull)name by:(NSInteger)value
+{
+    self.tokenizationStats[name] = @([self.tokenizationStats[name] integerValue] + value);
+}
+
 - (PKPaymentSummaryItem *_Nonnull)convertDisplayItemToPaymentSummaryItem:(NSDictionary *_Nonnull)displayItem;
 {
     NSDecimalNumber *decimalNumberAmount = [NSDecimalNumber decimalNumberWithString:displayItem[@"amount"][@"value"]];
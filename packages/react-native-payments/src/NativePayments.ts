@@ -14,6 +14,10 @@ export interface Spec extends TurboModule {
     // eslint-disable-next-line @typescript-eslint/no-wrapper-object-types,@typescript-eslint/ban-types
     show: (methodData: string, details: Object) => Promise<string>;
     setApiEndpoint:(url: string) => void;
+    // eslint-disable-next-line @typescript-eslint/no-wrapper-object-types,@typescript-eslint/ban-types
+    setTokenizationOptions: (options: Object) => void;
+    // eslint-disable-next-line @typescript-eslint/no-wrapper-object-types,@typescript-eslint/ban-types
+    getTokenizationStats: () => Promise<Object>;
 }
 
 // ts-prune-ignore-next
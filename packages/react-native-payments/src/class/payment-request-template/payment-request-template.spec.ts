@@ -0,0 +1,95 @@
+import { beforeEach, describe, expect, it, jest } from '@jest/globals';
+import { Platform } from 'react-native';
+
+import { PaymentMethodNameEnum } from '../../enum/payment-method-name.enum';
+import { SupportedNetworkEnum } from '../../enum/supported-networks.enum';
+
+import { PaymentRequestTemplate } from './payment-request-template';
+
+import type { AndroidPaymentDataRequest } from '../../@standard/android/request/android-payment-data-request';
+import type { IosPaymentDataRequest } from '../../@standard/ios/request/ios-payment-data-request';
+import type { PaymentDetailsInit } from '../../@standard/w3c/payment-details-init';
+import type { PaymentMethodData } from '../../@standard/w3c/payment-method-data';
+
+jest.mock('react-native', () => ({ Platform: { OS: 'android' } }));
+
+const methodData = [
+    {
+        supportedMethods: PaymentMethodNameEnum.ApplePay,
+        data: {
+            merchantIdentifier: 'merchant.com.example',
+            supportedNetworks: [SupportedNetworkEnum.Visa],
+            countryCode: 'US',
+            currencyCode: 'USD',
+        },
+    },
+    {
+        supportedMethods: PaymentMethodNameEnum.AndroidPay,
+        data: {
+            supportedNetworks: [SupportedNetworkEnum.Visa],
+            environment: 'TEST',
+            countryCode: 'US',
+            currencyCode: 'USD',
+            requestEmail: true,
+        },
+    },
+] as PaymentMethodData[];
+
+const getDetails = (value: string): PaymentDetailsInit => ({
+    total: { label: 'Total', amount: { currency: 'USD', value } },
+});
+
+describe('PaymentRequestTemplate', () => {
+    beforeEach(() => {
+        Platform.OS = 'android';
+    });
+
+    it('should serialize android payment data request with per checkout details', () => {
+        expect.hasAssertions();
+
+        const template = new PaymentRequestTemplate(methodData);
+
+        const first = JSON.parse(template.serialize(getDetails('10.00'))) as AndroidPaymentDataRequest;
+        const second = JSON.parse(template.serialize(getDetails('20.00'))) as AndroidPaymentDataRequest;
+
+        expect(first.merchantInfo).toStrictEqual({ merchantName: 'Total' });
+        expect(first.transactionInfo).toMatchObject({ currencyCode: 'USD', countryCode: 'US', totalPrice: '10.00' });
+        expect(first.emailRequired).toBe(true);
+        expect(first.allowedPaymentMethods[0].parameters.allowedCardNetworks).toStrictEqual(['VISA']);
+        expect(second.transactionInfo.totalPrice).toBe('20.00');
+        expect(second.allowedPaymentMethods).toStrictEqual(first.allowedPaymentMethods);
+    });
+
+    it('should serialize ios payment data request once', () => {
+        expect.hasAssertions();
+
+        Platform.OS = 'ios';
+        const template = new PaymentRequestTemplate(methodData);
+        const serialized = template.serialize(getDetails('10.00'));
+
+        expect(template.serialize(getDetails('20.00'))).toBe(serialized);
+        expect(JSON.parse(serialized) as IosPaymentDataRequest).toMatchObject({
+            merchantIdentifier: 'merchant.com.example',
+            countryCode: 'US',
+            currencyCode: 'USD',
+        });
+    });
+
+    it('should throw on empty payment methods', () => {
+        expect.hasAssertions();
+
+        expect(() => new PaymentRequestTemplate([])).toThrow('At least one payment method is required');
+    });
+
+    it('should skip payment methods validation for already validated payment methods', () => {
+        expect.hasAssertions();
+
+        expect(() => new PaymentRequestTemplate([], true)).toThrow('The operation is not supported.');
+    });
+
+    it('should throw if platform payment method is missing', () => {
+        expect.hasAssertions();
+
+        expect(() => new PaymentRequestTemplate([methodData[0]])).toThrow('The operation is not supported.');
+    });
+});
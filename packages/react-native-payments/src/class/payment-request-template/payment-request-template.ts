@@ -0,0 +1,194 @@
+import { Platform } from 'react-native';
+
+import { isDefined, isNotEmptyArray } from '../../shared';
+
+import { AndroidPaymentMethodTokenizationType } from '../../@standard/android/enum/android-payment-method-tokenization-type.enum';
+import { defaultAndroidPaymentDataRequest } from '../../@standard/android/request/android-payment-data-request';
+import { defaultAndroidPaymentMethod } from '../../@standard/android/request/android-payment-method';
+import { defaultAndroidTransactionInfo } from '../../@standard/android/request/android-transaction-info';
+import { IosPKMerchantCapability } from '../../@standard/ios/enum/ios-pk-merchant-capability.enum';
+import { IosPKPaymentNetworksEnum } from '../../@standard/ios/enum/ios-pk-payment-networks.enum';
+import { PaymentMethodNameEnum } from '../../enum/payment-method-name.enum';
+import { PaymentsErrorEnum } from '../../enum/payments-error.enum';
+import { SupportedNetworkEnum } from '../../enum/supported-networks.enum';
+import { DOMException } from '../../error/dom.exception';
+import { validatePaymentMethods } from '../../util/validate-payment-methods.util';
+
+import type { AndroidAllowedCardNetworksEnum } from '../../@standard/android/enum/android-allowed-card-networks.enum';
+import type { AndroidPaymentMethodDataDataInterface } from '../../@standard/android/mapping/android-payment-method-data-data.interface';
+import type { AndroidPaymentDataRequest } from '../../@standard/android/request/android-payment-data-request';
+import type { IosPaymentMethodDataDataInterface } from '../../@standard/ios/mapping/ios-payment-method-data-data.interface';
+import type { IosPaymentDataRequest } from '../../@standard/ios/request/ios-payment-data-request';
+import type { PaymentDetailsInit } from '../../@standard/w3c/payment-details-init';
+import type { PaymentMethodData } from '../../@standard/w3c/payment-method-data';
+
+type AndroidStaticPaymentDataRequest = Omit<AndroidPaymentDataRequest, 'merchantInfo' | 'transactionInfo'>;
+
+/*
+ * Validated and mapped to the native request merchant payment method configuration, that can be reused for every checkout.
+ * Only `PaymentDetailsInit` dependent fields are serialized per `PaymentRequest`.
+ */
+export class PaymentRequestTemplate {
+    readonly platformMethodData: AndroidPaymentMethodDataDataInterface | IosPaymentMethodDataDataInterface;
+
+    // HINT: Native payment data request without PaymentDetailsInit dependent fields
+    private readonly nativeStaticMethodData: AndroidStaticPaymentDataRequest | IosPaymentDataRequest;
+    private readonly serializedIosMethodData?: string;
+
+    /*
+     * `isValidated` is used by `PaymentRequest` which validates payment methods itself to keep the spec errors order
+     */
+    constructor(
+        readonly methodData: PaymentMethodData[],
+        isValidated = false
+    ) {
+        // 4. Process payment methods
+        if (!isValidated) {
+            validatePaymentMethods(methodData);
+        }
+
+        this.platformMethodData = this.findPlatformPaymentMethodData();
+
+        if (Platform.OS === 'android') {
+            this.nativeStaticMethodData = this.getAndroidStaticPaymentMethodData(
+                this.platformMethodData as AndroidPaymentMethodDataDataInterface
+            );
+        } else {
+            this.nativeStaticMethodData = this.getIosPaymentMethodData(
+                this.platformMethodData as IosPaymentMethodDataDataInterface
+            );
+            this.serializedIosMethodData = JSON.stringify(this.nativeStaticMethodData);
+        }
+    }
+
+    // 17. Set request.[[serializedMethodData]] to serializedMethodData.
+    serialize(details: PaymentDetailsInit): string {
+        if (isDefined(this.serializedIosMethodData)) {
+            return this.serializedIosMethodData;
+        }
+
+        const methodData = this.platformMethodData as AndroidPaymentMethodDataDataInterface;
+
+        const nativeMethodData: AndroidPaymentDataRequest = {
+            ...(this.nativeStaticMethodData as AndroidStaticPaymentDataRequest),
+            merchantInfo: {
+                merchantName: details.total.label,
+            },
+            transactionInfo: {
+                ...defaultAndroidTransactionInfo,
+                currencyCode: methodData.currencyCode,
+                totalPrice: details.total.amount.value,
+                totalPriceLabel: details.total.label,
+                countryCode: methodData.countryCode,
+            },
+        };
+
+        return JSON.stringify(nativeMethodData);
+    }
+
+    private findPlatformPaymentMethodData(): AndroidPaymentMethodDataDataInterface | IosPaymentMethodDataDataInterface {
+        const platformSupportedMethod =
+            Platform.OS === 'ios' ? PaymentMethodNameEnum.ApplePay : PaymentMethodNameEnum.AndroidPay;
+
+        const platformMethod = this.methodData.find(
+            paymentMethodData => paymentMethodData.supportedMethods === platformSupportedMethod
+        );
+
+        if (!isDefined(platformMethod)) {
+            throw new DOMException(PaymentsErrorEnum.NotSupportedError);
+        }
+
+        return platformMethod.data;
+    }
+
+    // eslint-disable-next-line class-methods-use-this,@typescript-eslint/class-methods-use-this
+    private getAndroidStaticPaymentMethodData(methodData: AndroidPaymentMethodDataDataInterface): AndroidStaticPaymentDataRequest {
+        return {
+            apiVersion: defaultAndroidPaymentDataRequest.apiVersion,
+            apiVersionMinor: defaultAndroidPaymentDataRequest.apiVersionMinor,
+            allowedPaymentMethods: [
+                {
+                    ...defaultAndroidPaymentMethod,
+                    parameters: {
+                        ...defaultAndroidPaymentMethod.parameters,
+                        allowedCardNetworks: methodData.supportedNetworks.map(
+                            network => network.toUpperCase() as AndroidAllowedCardNetworksEnum
+                        ),
+                        allowedAuthMethods:
+                            methodData.allowedAuthMethods ?? defaultAndroidPaymentMethod.parameters.allowedAuthMethods,
+                        ...(methodData.requestBilling === true && {
+                            billingAddressRequired: true,
+                            billingAddressParameters: {
+                                format: 'FULL',
+                                phoneNumberRequired: true,
+                            },
+                        }),
+                    },
+                    ...(isDefined(methodData.gatewayConfig) && {
+                        tokenizationSpecification: {
+                            parameters: methodData.gatewayConfig,
+                            type: AndroidPaymentMethodTokenizationType.PAYMENT_GATEWAY,
+                        },
+                    }),
+                    ...(isDefined(methodData.directConfig) && {
+                        tokenizationSpecification: {
+                            parameters: methodData.directConfig,
+                            type: AndroidPaymentMethodTokenizationType.DIRECT,
+                        },
+                    }),
+                },
+            ],
+            ...(methodData.requestEmail === true && { emailRequired: true }),
+            ...(methodData.requestShipping === true && {
+                shippingAddressRequired: true,
+                shippingAddressParameters: {
+                    phoneNumberRequired: true,
+                },
+            }),
+        };
+    }
+
+    // eslint-disable-next-line class-methods-use-this,@typescript-eslint/class-methods-use-this
+    private getIosPaymentMethodData(methodData: IosPaymentMethodDataDataInterface): IosPaymentDataRequest {
+        // TODO: Add mappings for other systems if needed
+        const supportedNetworkMap: Record<SupportedNetworkEnum, IosPKPaymentNetworksEnum> = {
+            [SupportedNetworkEnum.Amex]: IosPKPaymentNetworksEnum.PKPaymentNetworkAmex,
+            [SupportedNetworkEnum.Mastercard]: IosPKPaymentNetworksEnum.PKPaymentNetworkMasterCard,
+            [SupportedNetworkEnum.Visa]: IosPKPaymentNetworksEnum.PKPaymentNetworkVisa,
+            [SupportedNetworkEnum.Discover]: IosPKPaymentNetworksEnum.PKPaymentNetworkDiscover,
+            [SupportedNetworkEnum.Bancontact]: IosPKPaymentNetworksEnum.PKPaymentNetworkBancomat,
+            [SupportedNetworkEnum.CartesBancaires]: IosPKPaymentNetworksEnum.PKPaymentNetworkCartesBancaires,
+            [SupportedNetworkEnum.ChinaUnionPay]: IosPKPaymentNetworksEnum.PKPaymentNetworkChinaUnionPay,
+            [SupportedNetworkEnum.Dankort]: IosPKPaymentNetworksEnum.PKPaymentNetworkDankort,
+            [SupportedNetworkEnum.Eftpos]: IosPKPaymentNetworksEnum.PKPaymentNetworkEftpos,
+            [SupportedNetworkEnum.Electron]: IosPKPaymentNetworksEnum.PKPaymentNetworkElectron,
+            [SupportedNetworkEnum.Elo]: IosPKPaymentNetworksEnum.PKPaymentNetworkElo,
+            [SupportedNetworkEnum.Girocard]: IosPKPaymentNetworksEnum.PKPaymentNetworkGirocard,
+            [SupportedNetworkEnum.Interac]: IosPKPaymentNetworksEnum.PKPaymentNetworkInterac,
+            [SupportedNetworkEnum.Jcb]: IosPKPaymentNetworksEnum.PKPaymentNetworkJCB,
+            [SupportedNetworkEnum.Mada]: IosPKPaymentNetworksEnum.PKPaymentNetworkMada,
+            [SupportedNetworkEnum.Maestro]: IosPKPaymentNetworksEnum.PKPaymentNetworkMaestro,
+            [SupportedNetworkEnum.Mir]: IosPKPaymentNetworksEnum.PKPaymentNetworkMir,
+            [SupportedNetworkEnum.PrivateLabel]: IosPKPaymentNetworksEnum.PKPaymentNetworkPrivateLabel,
+            [SupportedNetworkEnum.Vpay]: IosPKPaymentNetworksEnum.PKPaymentNetworkVPay,
+        };
+
+        const defaultMerchantCapabilities = [
+            IosPKMerchantCapability.PKMerchantCapability3DS,
+            IosPKMerchantCapability.PKMerchantCapabilityDebit,
+            IosPKMerchantCapability.PKMerchantCapabilityCredit,
+        ];
+
+        return {
+            countryCode: methodData.countryCode,
+            currencyCode: methodData.currencyCode,
+            merchantIdentifier: methodData.merchantIdentifier,
+            supportedNetworks: methodData.supportedNetworks.map(network => supportedNetworkMap[network]),
+            merchantCapabilities: isNotEmptyArray(methodData.merchantCapabilities)
+                ? methodData.merchantCapabilities
+                : defaultMerchantCapabilities,
+            ...(methodData.requestBilling === true && { requiredBillingContactFields: true }),
+            ...(methodData.requestShipping === true && { requiredShippingContactFields: true }),
+        };
+    }
+}
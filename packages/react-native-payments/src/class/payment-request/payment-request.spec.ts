@@ -0,0 +1,80 @@
+import { beforeEach, describe, expect, it, jest } from '@jest/globals';
+import { Platform } from 'react-native';
+
+import { PaymentMethodNameEnum } from '../../enum/payment-method-name.enum';
+import { SupportedNetworkEnum } from '../../enum/supported-networks.enum';
+import { PaymentRequestTemplate } from '../payment-request-template/payment-request-template';
+
+import { PaymentRequest } from './payment-request';
+
+import type { PaymentDetailsInit } from '../../@standard/w3c/payment-details-init';
+import type { PaymentMethodData } from '../../@standard/w3c/payment-method-data';
+
+jest.mock('react-native', () => ({ Platform: { OS: 'android' } }));
+jest.mock('../native-payments/native-payments', () => ({ NativePayments: {} }));
+
+const iosMethodData = {
+    supportedMethods: PaymentMethodNameEnum.ApplePay,
+    data: {
+        merchantIdentifier: 'merchant.com.example',
+        supportedNetworks: [SupportedNetworkEnum.Visa],
+        countryCode: 'US',
+        currencyCode: 'USD',
+    },
+} as PaymentMethodData;
+
+const androidMethodData = {
+    supportedMethods: PaymentMethodNameEnum.AndroidPay,
+    data: {
+        supportedNetworks: [SupportedNetworkEnum.Visa],
+        environment: 'TEST',
+        countryCode: 'US',
+        currencyCode: 'USD',
+    },
+} as PaymentMethodData;
+
+const getDetails = (value: string): PaymentDetailsInit => ({
+    total: { label: 'Total', amount: { currency: 'USD', value } },
+});
+
+describe('PaymentRequest', () => {
+    beforeEach(() => {
+        Platform.OS = 'android';
+    });
+
+    it('should generate request id if it is not provided', () => {
+        expect.hasAssertions();
+
+        const details = getDetails('10.00');
+        const request = new PaymentRequest([androidMethodData], details);
+
+        expect(request.id).not.toBe('');
+        expect(details.id).toBe(request.id);
+    });
+
+    it('should validate payment methods before total', () => {
+        expect.hasAssertions();
+
+        expect(() => new PaymentRequest([], getDetails('0'))).toThrow('At least one payment method is required');
+    });
+
+    it('should validate total before looking up the platform payment method', () => {
+        expect.hasAssertions();
+
+        expect(() => new PaymentRequest([iosMethodData], getDetails('-1.00'))).toThrow(
+            'Total amount value should be non-negative'
+        );
+        expect(() => new PaymentRequest([iosMethodData], getDetails('10.00'))).toThrow('The operation is not supported.');
+    });
+
+    it('should validate details when created from the template', () => {
+        expect.hasAssertions();
+
+        const template = new PaymentRequestTemplate([iosMethodData, androidMethodData]);
+
+        expect(() => PaymentRequest.fromTemplate(template, getDetails('abc'))).toThrow(
+            `'abc' is not a valid amount format for total`
+        );
+        expect(PaymentRequest.fromTemplate(template, getDetails('10.00')).methodData).toBe(template.methodData);
+    });
+});
@@ -1,33 +1,23 @@
-/* eslint-disable max-lines */
 import { Platform } from 'react-native';
-import uuid from 'react-native-uuid';
 
-import { emptyFn, getErrorMessage, isDefined, isNotEmptyArray, isNotEmptyString } from '../../shared';
+import { emptyFn, getErrorMessage, isDefined, isNotEmptyString } from '../../shared';
 
-import { AndroidPaymentMethodTokenizationType } from '../../@standard/android/enum/android-payment-method-tokenization-type.enum';
-import { defaultAndroidPaymentDataRequest } from '../../@standard/android/request/android-payment-data-request';
-import { defaultAndroidPaymentMethod } from '../../@standard/android/request/android-payment-method';
-import { defaultAndroidTransactionInfo } from '../../@standard/android/request/android-transaction-info';
-import { IosPKMerchantCapability } from '../../@standard/ios/enum/ios-pk-merchant-capability.enum';
-import { IosPKPaymentNetworksEnum } from '../../@standard/ios/enum/ios-pk-payment-networks.enum';
 import { PaymentMethodNameEnum } from '../../enum/payment-method-name.enum';
 import { PaymentsErrorEnum } from '../../enum/payments-error.enum';
-import { SupportedNetworkEnum } from '../../enum/supported-networks.enum';
 import { ConstructorError } from '../../error/constructor.error';
 import { DOMException } from '../../error/dom.exception';
 import { PaymentsError } from '../../error/payments.error';
+import { generateRequestId } from '../../util/generate-request-id.util';
 import { validateDisplayItems } from '../../util/validate-display-items.util';
 import { validatePaymentMethods } from '../../util/validate-payment-methods.util';
 import { validateTotal } from '../../util/validate-total.util';
 import { NativePayments } from '../native-payments/native-payments';
+import { PaymentRequestTemplate } from '../payment-request-template/payment-request-template';
 import { AndroidPaymentResponse } from '../payment-response/android-payment-response';
 import { IosPaymentResponse } from '../payment-response/ios-payment-response';
 
-import type { AndroidAllowedCardNetworksEnum } from '../../@standard/android/enum/android-allowed-card-networks.enum';
 import type { AndroidPaymentMethodDataDataInterface } from '../../@standard/android/mapping/android-payment-method-data-data.interface';
-import type { AndroidPaymentDataRequest } from '../../@standard/android/request/android-payment-data-request';
 import type { IosPaymentMethodDataDataInterface } from '../../@standard/ios/mapping/ios-payment-method-data-data.interface';
-import type { IosPaymentDataRequest } from '../../@standard/ios/request/ios-payment-data-request';
 import type { PaymentDetailsInit } from '../../@standard/w3c/payment-details-init';
 import type { PaymentMethodData } from '../../@standard/w3c/payment-method-data';
 
@@ -47,20 +37,21 @@ export class PaymentRequest {
 
     private acceptPromiseRejecter: (reason: unknown) => void = emptyFn;
 
-    // eslint-disable-next-line max-statements
     constructor(
         readonly methodData: PaymentMethodData[],
-        public details: PaymentDetailsInit
+        public details: PaymentDetailsInit,
+        template?: PaymentRequestTemplate
     ) {
         // 3. Establish the request's id:
         if (!isNotEmptyString(details.id)) {
-            // TODO: Can we avoid using external lib? Use Math.random?
-            details.id = uuid.v4() as string;
+            details.id = generateRequestId();
         }
         this.id = details.id;
 
-        // 4. Process payment methods
-        validatePaymentMethods(methodData);
+        // 4. Process payment methods, template payment methods are already processed
+        if (!isDefined(template)) {
+            validatePaymentMethods(methodData);
+        }
 
         // 5. Process the total
         validateTotal(details.total, ConstructorError);
@@ -68,15 +59,11 @@ export class PaymentRequest {
         // 6. If the displayItems member of details is present, then for each item in details.displayItems:
         validateDisplayItems(details.displayItems, ConstructorError);
 
-        // 17. Set request.[[serializedMethodData]] to serializedMethodData.         */
-        this.platformMethodData = this.findPlatformPaymentMethodData();
-
-        const nativePlatformMethodData =
-            Platform.OS === 'android'
-                ? this.getAndroidPaymentMethodData(this.platformMethodData as AndroidPaymentMethodDataDataInterface, details)
-                : this.getIosPaymentMethodData(this.platformMethodData as IosPaymentMethodDataDataInterface);
+        // 17. Set request.[[serializedMethodData]] to serializedMethodData.
+        const requestTemplate = template ?? new PaymentRequestTemplate(methodData, true);
 
-        this.serializedMethodData = JSON.stringify(nativePlatformMethodData);
+        this.platformMethodData = requestTemplate.platformMethodData;
+        this.serializedMethodData = requestTemplate.serialize(details);
     }
 
     // https://www.w3.org/TR/payment-request/#canmakepayment-method
@@ -144,121 +131,10 @@ export class PaymentRequest {
         }
     }
 
-    private findPlatformPaymentMethodData(): AndroidPaymentMethodDataDataInterface | IosPaymentMethodDataDataInterface {
-        const platformSupportedMethod =
-            Platform.OS === 'ios' ? PaymentMethodNameEnum.ApplePay : PaymentMethodNameEnum.AndroidPay;
-
-        const platformMethod = this.methodData.find(
-            paymentMethodData => paymentMethodData.supportedMethods === platformSupportedMethod
-        );
-
-        if (!isDefined(platformMethod)) {
-            throw new DOMException(PaymentsErrorEnum.NotSupportedError);
-        }
-
-        return platformMethod.data;
-    }
-
-    // eslint-disable-next-line class-methods-use-this,@typescript-eslint/class-methods-use-this
-    private getAndroidPaymentMethodData(
-        methodData: AndroidPaymentMethodDataDataInterface,
-        details: PaymentDetailsInit
-    ): AndroidPaymentDataRequest {
-        return {
-            ...defaultAndroidPaymentDataRequest,
-            merchantInfo: {
-                merchantName: details.total.label,
-            },
-            transactionInfo: {
-                ...defaultAndroidTransactionInfo,
-                currencyCode: methodData.currencyCode,
-                totalPrice: details.total.amount.value,
-                totalPriceLabel: details.total.label,
-                countryCode: methodData.countryCode,
-            },
-            allowedPaymentMethods: [
-                {
-                    ...defaultAndroidPaymentMethod,
-                    parameters: {
-                        ...defaultAndroidPaymentMethod.parameters,
-                        allowedCardNetworks: methodData.supportedNetworks.map(
-                            network => network.toUpperCase() as AndroidAllowedCardNetworksEnum
-                        ),
-                        allowedAuthMethods:
-                            methodData.allowedAuthMethods ?? defaultAndroidPaymentMethod.parameters.allowedAuthMethods,
-                        ...(methodData.requestBilling === true && {
-                            billingAddressRequired: true,
-                            billingAddressParameters: {
-                                format: 'FULL',
-                                phoneNumberRequired: true,
-                            },
-                        }),
-                    },
-                    ...(isDefined(methodData.gatewayConfig) && {
-                        tokenizationSpecification: {
-                            parameters: methodData.gatewayConfig,
-                            type: AndroidPaymentMethodTokenizationType.PAYMENT_GATEWAY,
-                        },
-                    }),
-                    ...(isDefined(methodData.directConfig) && {
-                        tokenizationSpecification: {
-                            parameters: methodData.directConfig,
-                            type: AndroidPaymentMethodTokenizationType.DIRECT,
-                        },
-                    }),
-                },
-            ],
-            ...(methodData.requestEmail === true && { emailRequired: true }),
-            ...(methodData.requestShipping === true && {
-                shippingAddressRequired: true,
-                shippingAddressParameters: {
-                    phoneNumberRequired: true,
-                },
-            }),
-        };
-    }
-
-    // eslint-disable-next-line class-methods-use-this,@typescript-eslint/class-methods-use-this
-    private getIosPaymentMethodData(methodData: IosPaymentMethodDataDataInterface): IosPaymentDataRequest {
-        // TODO: Add mappings for other systems if needed
-        const supportedNetworkMap: Record<SupportedNetworkEnum, IosPKPaymentNetworksEnum> = {
-            [SupportedNetworkEnum.Amex]: IosPKPaymentNetworksEnum.PKPaymentNetworkAmex,
-            [SupportedNetworkEnum.Mastercard]: IosPKPaymentNetworksEnum.PKPaymentNetworkMasterCard,
-            [SupportedNetworkEnum.Visa]: IosPKPaymentNetworksEnum.PKPaymentNetworkVisa,
-            [SupportedNetworkEnum.Discover]: IosPKPaymentNetworksEnum.PKPaymentNetworkDiscover,
-            [SupportedNetworkEnum.Bancontact]: IosPKPaymentNetworksEnum.PKPaymentNetworkBancomat,
-            [SupportedNetworkEnum.CartesBancaires]: IosPKPaymentNetworksEnum.PKPaymentNetworkCartesBancaires,
-            [SupportedNetworkEnum.ChinaUnionPay]: IosPKPaymentNetworksEnum.PKPaymentNetworkChinaUnionPay,
-            [SupportedNetworkEnum.Dankort]: IosPKPaymentNetworksEnum.PKPaymentNetworkDankort,
-            [SupportedNetworkEnum.Eftpos]: IosPKPaymentNetworksEnum.PKPaymentNetworkEftpos,
-            [SupportedNetworkEnum.Electron]: IosPKPaymentNetworksEnum.PKPaymentNetworkElectron,
-            [SupportedNetworkEnum.Elo]: IosPKPaymentNetworksEnum.PKPaymentNetworkElo,
-            [SupportedNetworkEnum.Girocard]: IosPKPaymentNetworksEnum.PKPaymentNetworkGirocard,
-            [SupportedNetworkEnum.Interac]: IosPKPaymentNetworksEnum.PKPaymentNetworkInterac,
-            [SupportedNetworkEnum.Jcb]: IosPKPaymentNetworksEnum.PKPaymentNetworkJCB,
-            [SupportedNetworkEnum.Mada]: IosPKPaymentNetworksEnum.PKPaymentNetworkMada,
-            [SupportedNetworkEnum.Maestro]: IosPKPaymentNetworksEnum.PKPaymentNetworkMaestro,
-            [SupportedNetworkEnum.Mir]: IosPKPaymentNetworksEnum.PKPaymentNetworkMir,
-            [SupportedNetworkEnum.PrivateLabel]: IosPKPaymentNetworksEnum.PKPaymentNetworkPrivateLabel,
-            [SupportedNetworkEnum.Vpay]: IosPKPaymentNetworksEnum.PKPaymentNetworkVPay,
-        };
-
-        const defaultMerchantCapabilities = [
-            IosPKMerchantCapability.PKMerchantCapability3DS,
-            IosPKMerchantCapability.PKMerchantCapabilityDebit,
-            IosPKMerchantCapability.PKMerchantCapabilityCredit,
-        ];
-
-        return {
-            countryCode: methodData.countryCode,
-            currencyCode: methodData.currencyCode,
-            merchantIdentifier: methodData.merchantIdentifier,
-            supportedNetworks: methodData.supportedNetworks.map(network => supportedNetworkMap[network]),
-            merchantCapabilities: isNotEmptyArray(methodData.merchantCapabilities)
-                ? methodData.merchantCapabilities
-                : defaultMerchantCapabilities,
-            ...(methodData.requestBilling === true && { requiredBillingContactFields: true }),
-            ...(methodData.requestShipping === true && { requiredShippingContactFields: true }),
-        };
+    /*
+     * Create PaymentRequest from the PaymentRequestTemplate, skipping payment methods validation and serialization
+     */
+    static fromTemplate(template: PaymentRequestTemplate, details: PaymentDetailsInit): PaymentRequest {
+        return new PaymentRequest(template.methodData, details, template);
     }
 }
@@ -0,0 +1,79 @@
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { PaymentsError } from '../../error/payments.error';
+
+import { AndroidPaymentResponse } from './android-payment-response';
+
+jest.mock('../native-payments/native-payments', () => ({ NativePayments: {} }));
+
+const signedKey = JSON.stringify({ keyValue: 'key', keyExpiration: '1893456000000' });
+const signedMessage = JSON.stringify({ encryptedMessage: 'message', ephemeralPublicKey: 'public', tag: 'tag' });
+
+const getPaymentData = (token: string): string =>
+    JSON.stringify({
+        apiVersion: 2,
+        apiVersionMinor: 0,
+        email: 'jane.doe@example.com',
+        paymentMethodData: {
+            description: 'Visa 1111',
+            type: 'CARD',
+            info: {
+                cardNetwork: 'VISA',
+                cardDetails: '1111',
+                billingAddress: { name: 'Jane Doe', phoneNumber: '+1 555-0100', countryCode: 'US', postalCode: '94043' },
+            },
+            tokenizationData: { type: 'PAYMENT_GATEWAY', token },
+        },
+    });
+
+const validToken = JSON.stringify({
+    protocolVersion: 'ECv2',
+    signature: 'signature',
+    intermediateSigningKey: { signedKey, signatures: ['signature'] },
+    signedMessage,
+});
+
+describe('AndroidPaymentResponse', () => {
+    it('should decode payment token on the first access only', () => {
+        expect.hasAssertions();
+
+        const parse = jest.spyOn(JSON, 'parse');
+        const response = new AndroidPaymentResponse('id', 'android-pay', getPaymentData(validToken));
+
+        expect(parse).toHaveBeenCalledTimes(1);
+        expect(response.details.payerEmail).toBe('jane.doe@example.com');
+        expect(response.details.payerName).toBe('Jane Doe');
+        expect(response.details.payerPhone).toBe('+1 555-0100');
+        expect(response.details.billingAddress.postalCode).toBe('94043');
+        expect(parse).toHaveBeenCalledTimes(1);
+
+        const token = response.details.androidPayToken;
+
+        expect(token.rawToken).toBe(validToken);
+        expect(token.signedMessage.encryptedMessage).toBe('message');
+        expect(token.intermediateSigningKey.signedKey.keyValue).toBe('key');
+        expect(token.cardInfo.cardNetwork).toBe('VISA');
+        expect(response.details.androidPayToken).toBe(token);
+        expect(parse).toHaveBeenCalledTimes(4);
+
+        parse.mockRestore();
+    });
+
+    it('should throw PaymentsError on malformed payment token access', () => {
+        expect.hasAssertions();
+
+        const response = new AndroidPaymentResponse('id', 'android-pay', getPaymentData('{'));
+
+        expect(response.details.payerEmail).toBe('jane.doe@example.com');
+        expect(() => response.details.androidPayToken).toThrow(PaymentsError);
+    });
+
+    it('should allow overwriting details fields', () => {
+        expect.hasAssertions();
+
+        const response = new AndroidPaymentResponse('id', 'android-pay', getPaymentData(validToken));
+        response.details.payerEmail = 'john.doe@example.com';
+
+        expect(response.details.payerEmail).toBe('john.doe@example.com');
+    });
+});
@@ -0,0 +1,62 @@
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { emptyIosPaymentData } from '../../@standard/ios/response/ios-payment-data';
+import { PaymentsError } from '../../error/payments.error';
+
+import { IosPaymentResponse } from './ios-payment-response';
+
+jest.mock('../native-payments/native-payments', () => ({ NativePayments: {} }));
+
+const getPKPayment = (paymentData: string): string =>
+    JSON.stringify({
+        token: {
+            transactionIdentifier: 'transaction',
+            paymentData,
+            paymentMethod: { displayName: 'Visa 1111', network: 'Visa', type: 'PKPaymentMethodTypeCredit' },
+        },
+        billingContact: { postalAddress: { street: '1 Infinite Loop', postalCode: '95014', ISOCountryCode: 'US' } },
+        shippingContact: {
+            emailAddress: 'jane.doe@example.com',
+            phoneNumber: { stringValue: '+1 555-0100' },
+            name: { givenName: 'Jane', familyName: 'Doe' },
+        },
+    });
+
+describe('IosPaymentResponse', () => {
+    it('should decode payment data on the first access only', () => {
+        expect.hasAssertions();
+
+        const parse = jest.spyOn(JSON, 'parse');
+        const response = new IosPaymentResponse('id', 'apple-pay', getPKPayment('{"version":"EC_v1","data":"data"}'));
+
+        expect(response.details.payerName).toBe('Doe,Jane');
+        expect(response.details.payerPhone).toBe('+1 555-0100');
+        expect(response.details.billingAddress.address1).toBe('1 Infinite Loop');
+        expect(parse).toHaveBeenCalledTimes(1);
+
+        const token = response.details.applePayToken;
+
+        expect(token.paymentData).toMatchObject({ version: 'EC_v1', data: 'data' });
+        expect(response.details.applePayToken).toBe(token);
+        expect(parse).toHaveBeenCalledTimes(2);
+
+        parse.mockRestore();
+    });
+
+    it('should use empty payment data for empty token', () => {
+        expect.hasAssertions();
+
+        const response = new IosPaymentResponse('id', 'apple-pay', getPKPayment(''));
+
+        expect(response.details.applePayToken.paymentData).toBe(emptyIosPaymentData);
+    });
+
+    it('should throw PaymentsError on malformed payment data access', () => {
+        expect.hasAssertions();
+
+        const response = new IosPaymentResponse('id', 'apple-pay', getPKPayment('{'));
+
+        expect(response.details.payerEmail).toBe('jane.doe@example.com');
+        expect(() => response.details.applePayToken).toThrow(PaymentsError);
+    });
+});
@@ -1,7 +1,8 @@
-import { isNotEmptyString } from "../../shared"
+import { isNotEmptyString } from '../../shared';
 
 import { emptyAndroidPaymentMethodToken } from '../../@standard/android/response/android-payment-method-token';
 import { emptyIosPaymentData } from '../../@standard/ios/response/ios-payment-data';
+import { createLazyObject } from '../../util/create-lazy-object.util';
 
 import { PaymentResponse } from './payment-response';
 
@@ -13,20 +14,28 @@ import type { IosPKPayment } from '../../@standard/ios/response/ios-pk-payment';
 import type { IosPKToken } from '../../@standard/ios/response/ios-pk-token';
 import type { IosRawPKToken } from '../../@standard/ios/response/ios-raw-pk-token';
 import type { PaymentResponseAddressInterface } from '../../interface/payment-response-address.interface';
+import type { PaymentResponseDetailsInterface } from '../../interface/payment-response-details.interface';
 
 export class IosPaymentResponse extends PaymentResponse {
     constructor(requestId: string, methodName: string, jsonData: string) {
         const data = JSON.parse(jsonData) as IosPKPayment;
 
-        super(requestId, methodName, {
-            billingAddress: IosPaymentResponse.parsePKContact(data.billingContact?.postalAddress),
-            applePayToken: IosPaymentResponse.parsePkToken(data.token),
-            androidPayToken: emptyAndroidPaymentMethodToken,
-            payerEmail: data.shippingContact?.emailAddress ?? '',
-            payerName: IosPaymentResponse.parseNSPersonNameComponents(data.shippingContact?.name),
-            payerPhone: IosPaymentResponse.parseCNPhoneNumber(data.shippingContact?.phoneNumber),
-            shippingAddress: IosPaymentResponse.parsePKContact(data.shippingContact?.postalAddress),
-        });
+        // HINT: Nested paymentData JSON is parsed only when token field is accessed
+        super(
+            requestId,
+            methodName,
+            createLazyObject<PaymentResponseDetailsInterface, 'applePayToken'>(
+                {
+                    billingAddress: IosPaymentResponse.parsePKContact(data.billingContact?.postalAddress),
+                    androidPayToken: emptyAndroidPaymentMethodToken,
+                    payerEmail: data.shippingContact?.emailAddress ?? '',
+                    payerName: IosPaymentResponse.parseNSPersonNameComponents(data.shippingContact?.name),
+                    payerPhone: IosPaymentResponse.parseCNPhoneNumber(data.shippingContact?.phoneNumber),
+                    shippingAddress: IosPaymentResponse.parsePKContact(data.shippingContact?.postalAddress),
+                },
+                { applePayToken: () => IosPaymentResponse.parsePkToken(data.token) }
+            )
+        );
     }
 
     private static parsePkToken(input: IosRawPKToken): IosPKToken {
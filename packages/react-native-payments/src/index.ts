@@ -22,4 +22,9 @@ export type { IosPKToken } from './@standard/ios/response/ios-pk-token';
 export { IosPaymentResponse } from './class/payment-response/ios-payment-response';
 
 export { PaymentRequest } from './class/payment-request/payment-request';
+export { PaymentRequestTemplate } from './class/payment-request-template/payment-request-template';
 export { PaymentResponse } from './class/payment-response/payment-response';
+
+export { getTokenizationStats, setTokenizationOptions } from './util/tokenization.util';
+export type { TokenizationOptionsInterface } from './interface/tokenization-options.interface';
+export type { TokenizationStatsInterface } from './interface/tokenization-stats.interface';
@@ -0,0 +1,11 @@
+/**
+ * ApplePay Cardpointe tokenization client options, ignored by AndroidPay
+ */
+export interface TokenizationOptionsInterface {
+    // Deadline of a single tokenization attempt, 10000 by default
+    attemptTimeoutMs?: number;
+    // Start hedged attempt if previous one is still running after this delay, 0 (disabled) by default
+    hedgeDelayMs?: number;
+    // Maximum attempts including retries and hedged attempts, 2 by default
+    maxAttempts?: number;
+}
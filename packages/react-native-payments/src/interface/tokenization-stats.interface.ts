@@ -0,0 +1,14 @@
+/**
+ * ApplePay Cardpointe tokenization client counters, empty for AndroidPay
+ */
+export interface TokenizationStatsInterface {
+    attempts?: number;
+    failures?: number;
+    hedgedAttempts?: number;
+    lastLatencyMs?: number;
+    maxLatencyMs?: number;
+    requests?: number;
+    successes?: number;
+    timeouts?: number;
+    totalLatencyMs?: number;
+}
@@ -0,0 +1,69 @@
+import { describe, expect, it, jest } from '@jest/globals';
+
+import { PaymentsError } from '../error/payments.error';
+
+import { createLazyObject } from './create-lazy-object.util';
+
+interface LazyObjectInterface {
+    count: number;
+    token: { value: string };
+}
+
+describe('createLazyObject', () => {
+    it('should calculate lazy field on the first access only and keep other fields plain', () => {
+        expect.hasAssertions();
+
+        const tokenFactory = jest.fn(() => JSON.parse('{"value":"token"}') as LazyObjectInterface['token']);
+        const lazyObject = createLazyObject<LazyObjectInterface, 'token'>({ count: 1 }, { token: tokenFactory });
+
+        expect(Object.getOwnPropertyDescriptor(lazyObject, 'count')).toStrictEqual({
+            configurable: true,
+            enumerable: true,
+            value: 1,
+            writable: true,
+        });
+        expect(tokenFactory).not.toHaveBeenCalled();
+        expect(lazyObject.token).toStrictEqual({ value: 'token' });
+        expect(lazyObject.token).toBe(lazyObject.token);
+        expect(tokenFactory).toHaveBeenCalledTimes(1);
+    });
+
+    it('should rethrow field factory error as PaymentsError on the field access', () => {
+        expect.hasAssertions();
+
+        const lazyObject = createLazyObject<LazyObjectInterface, 'token'>(
+            { count: 1 },
+            { token: () => JSON.parse('{') as LazyObjectInterface['token'] }
+        );
+
+        expect(lazyObject.count).toBe(1);
+        expect(() => lazyObject.token).toThrow(PaymentsError);
+        expect(() => lazyObject.token).toThrow('Failed parsing payment response token');
+    });
+
+    it('should keep fields enumerable, writable and configurable', () => {
+        expect.hasAssertions();
+
+        const lazyObject = createLazyObject<LazyObjectInterface, 'token'>(
+            { count: 1 },
+            { token: () => ({ value: 'token' }) }
+        );
+
+        expect(Object.keys(lazyObject)).toStrictEqual(['count', 'token']);
+
+        lazyObject.token = { value: 'overwritten' };
+        expect(lazyObject.token).toStrictEqual({ value: 'overwritten' });
+
+        expect(lazyObject.count).toBe(1);
+        lazyObject.count = 2;
+        expect(lazyObject.count).toBe(2);
+        expect(Object.getOwnPropertyDescriptor(lazyObject, 'count')).toStrictEqual({
+            configurable: true,
+            enumerable: true,
+            value: 2,
+            writable: true,
+        });
+
+        expect(Reflect.deleteProperty(lazyObject, 'count')).toBe(true);
+    });
+});
@@ -0,0 +1,43 @@
+import { getErrorMessage } from '../shared';
+
+import { PaymentsError } from '../error/payments.error';
+
+type LazyObjectFactories<T> = { [K in keyof T]-?: () => T[K] };
+
+const defineValue = <T extends object>(lazyObject: T, key: keyof T, value: T[keyof T]): void => {
+    Object.defineProperty(lazyObject, key, { configurable: true, enumerable: true, value, writable: true });
+};
+
+/**
+ * Create object with plain `values` and `factories` fields calculated on the first access and then stored as plain
+ * writable values, only expensive fields should be lazy as every getter costs a property definition.
+ * Field factory errors are rethrown as `PaymentsError` on the field access.
+ */
+export const createLazyObject = <T extends object, K extends keyof T>(
+    values: Omit<T, K>,
+    factories: LazyObjectFactories<Pick<T, K>>
+): T => {
+    const lazyObject = { ...values } as T;
+
+    (Object.keys(factories) as K[]).forEach(key => {
+        Object.defineProperty(lazyObject, key, {
+            configurable: true,
+            enumerable: true,
+            get: () => {
+                let value: T[K];
+                try {
+                    value = factories[key]();
+                } catch (e) {
+                    throw new PaymentsError(`Failed parsing payment response ${String(key)}: ${getErrorMessage(e)}`);
+                }
+
+                defineValue(lazyObject, key, value);
+
+                return value;
+            },
+            set: (value: T[K]) => void defineValue(lazyObject, key, value),
+        });
+    });
+
+    return lazyObject;
+};
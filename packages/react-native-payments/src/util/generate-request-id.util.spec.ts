@@ -0,0 +1,85 @@
+import { afterEach, describe, expect, it, jest } from '@jest/globals';
+
+import type { generateRequestId as GenerateRequestIdType } from './generate-request-id.util';
+
+const UUID_V4_REGEXP = /^[\da-f]{8}-[\da-f]{4}-4[\da-f]{3}-[89ab][\da-f]{3}-[\da-f]{12}$/u;
+const IDS_COUNT = 10000;
+// HINT: One id more than fits in the prefetched random values pool
+const POOL_OVERFLOW_IDS_COUNT = 65;
+const MAX_BYTE = 0xff;
+
+const originalCrypto = Object.getOwnPropertyDescriptor(globalThis, 'crypto');
+
+const setCrypto = (value: unknown): void => {
+    Object.defineProperty(globalThis, 'crypto', { configurable: true, value, writable: true });
+};
+
+const loadGenerateRequestId = (): typeof GenerateRequestIdType => {
+    let module = {} as { generateRequestId: typeof GenerateRequestIdType };
+
+    jest.isolateModules(() => {
+        // eslint-disable-next-line @typescript-eslint/no-require-imports,@typescript-eslint/no-var-requires
+        module = require('./generate-request-id.util') as typeof module;
+    });
+
+    return module.generateRequestId;
+};
+
+describe('generateRequestId', () => {
+    afterEach(() => {
+        if (originalCrypto === undefined) {
+            Reflect.deleteProperty(globalThis, 'crypto');
+        } else {
+            Object.defineProperty(globalThis, 'crypto', originalCrypto);
+        }
+    });
+
+    it('should generate unique RFC4122 version 4 UUIDs', () => {
+        expect.hasAssertions();
+
+        const generateRequestId = loadGenerateRequestId();
+        const ids = Array.from({ length: IDS_COUNT }, () => generateRequestId());
+
+        expect(ids.every(id => UUID_V4_REGEXP.test(id))).toBe(true);
+        expect(new Set(ids).size).toBe(IDS_COUNT);
+    });
+
+    it('should use crypto.getRandomValues when it is available', () => {
+        expect.hasAssertions();
+
+        const getRandomValues = jest.fn((array: Uint8Array) => array.fill(MAX_BYTE));
+        setCrypto({ getRandomValues });
+
+        const generateRequestId = loadGenerateRequestId();
+
+        expect(generateRequestId()).toBe('ffffffff-ffff-4fff-bfff-ffffffffffff');
+        expect(getRandomValues).toHaveBeenCalledTimes(1);
+    });
+
+    it('should prefetch random values for several ids', () => {
+        expect.hasAssertions();
+
+        const getRandomValues = jest.fn((array: Uint8Array) => array.fill(0));
+        setCrypto({ getRandomValues });
+
+        const generateRequestId = loadGenerateRequestId();
+        const ids = Array.from({ length: POOL_OVERFLOW_IDS_COUNT }, () => generateRequestId());
+
+        expect(ids[0]).toBe('00000000-0000-4000-8000-000000000000');
+        expect(getRandomValues).toHaveBeenCalledTimes(2);
+    });
+
+    it('should fall back to Math.random without crypto', () => {
+        expect.hasAssertions();
+
+        setCrypto(undefined);
+        const random = jest.spyOn(Math, 'random').mockReturnValue(0);
+
+        const generateRequestId = loadGenerateRequestId();
+
+        expect(generateRequestId()).toBe('00000000-0000-4000-8000-000000000000');
+        expect(random).toHaveBeenCalledWith();
+
+        random.mockRestore();
+    });
+});
@@ -0,0 +1,62 @@
+const UUID_BYTES = 16;
+const POOL_UUIDS = 64;
+const BYTE_RANGE = 256;
+const VERSION_BYTE = 6;
+const VARIANT_BYTE = 8;
+const VERSION_4 = 0x40;
+const VARIANT_RFC4122 = 0x80;
+const LOW_NIBBLE_MASK = 0x0f;
+const LOW_SIX_BITS_MASK = 0x3f;
+const HEX_RADIX = 16;
+const HYPHEN_POSITIONS = new Set([4, 6, 8, 10]);
+
+const byteToHex = Array.from({ length: BYTE_RANGE }, (_, byte) => byte.toString(HEX_RADIX).padStart(2, '0'));
+
+interface RandomValuesSource {
+    getRandomValues: (array: Uint8Array) => Uint8Array;
+}
+
+// HINT: Hermes provides `crypto` only with a polyfill like react-native-get-random-values
+const cryptoSource = (globalThis as { crypto?: Partial<RandomValuesSource> }).crypto;
+
+const fillRandomValues = (array: Uint8Array): void => {
+    if (typeof cryptoSource?.getRandomValues === 'function') {
+        cryptoSource.getRandomValues(array);
+
+        return;
+    }
+
+    for (let idx = 0; idx < array.length; idx++) {
+        array[idx] = Math.floor(Math.random() * BYTE_RANGE);
+    }
+};
+
+// HINT: Random bytes are prefetched for several ids at once to amortize the native call cost
+const randomPool = new Uint8Array(UUID_BYTES * POOL_UUIDS);
+let randomPoolOffset = randomPool.length;
+
+/**
+ * Generate unique PaymentRequest id, formatted as RFC4122 version 4 UUID.
+ * Uses `crypto.getRandomValues` when it is available, so ids are not predictable.
+ *
+ * https://www.w3.org/TR/payment-request/#dom-paymentdetailsinit-id
+ */
+export const generateRequestId = (): string => {
+    if (randomPoolOffset === randomPool.length) {
+        fillRandomValues(randomPool);
+        randomPoolOffset = 0;
+    }
+
+    const offset = randomPoolOffset;
+    randomPoolOffset += UUID_BYTES;
+
+    randomPool[offset + VERSION_BYTE] = (randomPool[offset + VERSION_BYTE] & LOW_NIBBLE_MASK) | VERSION_4;
+    randomPool[offset + VARIANT_BYTE] = (randomPool[offset + VARIANT_BYTE] & LOW_SIX_BITS_MASK) | VARIANT_RFC4122;
+
+    let id = '';
+    for (let idx = 0; idx < UUID_BYTES; idx++) {
+        id += `${HYPHEN_POSITIONS.has(idx) ? '-' : ''}${byteToHex[randomPool[offset + idx]]}`;
+    }
+
+    return id;
+};
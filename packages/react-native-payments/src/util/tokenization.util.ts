@@ -0,0 +1,11 @@
+import { NativePayments } from '../class/native-payments/native-payments';
+
+import type { TokenizationOptionsInterface } from '../interface/tokenization-options.interface';
+import type { TokenizationStatsInterface } from '../interface/tokenization-stats.interface';
+
+export const setTokenizationOptions = (options: TokenizationOptionsInterface): void => {
+    NativePayments.setTokenizationOptions(options);
+};
+
+export const getTokenizationStats = async (): Promise<TokenizationStatsInterface> =>
+    (await NativePayments.getTokenizationStats()) as TokenizationStatsInterface;
@@ -25,3 +25,4 @@ export { cs } from './util/cs/cs';
 export { emptyFn } from './util/empty-fn/empty-fn';
 export { getErrorMessage } from './util/get-error-message/get-error-message';
 export { getDefined } from './util/get-defined/get-defined';
+export { groupBy } from './util/group-by/group-by';
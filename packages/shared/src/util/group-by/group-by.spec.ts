@@ -0,0 +1,23 @@
+import { describe, expect, it } from '@jest/globals';
+
+import { groupBy } from './group-by';
+
+describe('groupBy', () => {
+    it('should group items by key in the order of the first appearance', () => {
+        expect.hasAssertions();
+
+        const result = groupBy(['b1', 'a1', 'b2', 'c1', 'a2'], item => item[0]);
+
+        expect([...result.entries()]).toStrictEqual([
+            ['b', ['b1', 'b2']],
+            ['a', ['a1', 'a2']],
+            ['c', ['c1']],
+        ]);
+    });
+
+    it('should return empty map for empty items', () => {
+        expect.hasAssertions();
+
+        expect(groupBy([], item => item).size).toBe(0);
+    });
+});
@@ -0,0 +1,23 @@
+/**
+ * Group items by key, groups and items in them keep the order of the first appearance
+ *
+ * @param items Items to group
+ * @param keyFn Function returning group key of the item
+ * @returns Map of group key to group items
+ */
+export const groupBy = <T, K>(items: T[], keyFn: (item: T) => K): Map<K, T[]> => {
+    const groups = new Map<K, T[]>();
+
+    for (const item of items) {
+        const key = keyFn(item);
+        const group = groups.get(key);
+
+        if (group === undefined) {
+            groups.set(key, [item]);
+        } else {
+            group.push(item);
+        }
+    }
+
+    return groups;
+};